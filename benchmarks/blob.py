@@ -0,0 +1,142 @@
+"""Write amplification and read latency of large values with and without blob separation (`enable_blob_files`)
+
+Every key is written `--rounds` times so compactions have something to rewrite. Write amplification is
+(flush + compaction bytes written) / user bytes written, from the `rocksdb.flush.write.bytes`,
+`rocksdb.compact.write.bytes` and `rocksdb.bytes.written` tickers; blob files count towards the flush and
+compaction bytes. Reads are random `get`s after background compactions settle.
+
+Usage:
+    python benchmarks/blob.py [--keys 2000] [--value-size 100000] [--rounds 3] [--path /tmp/rocksdb-bench]
+"""
+
+from argparse import ArgumentParser
+from os import urandom
+from random import Random
+from shutil import rmtree
+from time import perf_counter, perf_counter_ns
+
+import rocksdb, asyncio
+
+PROPERTIES = [
+    "rocksdb.num-running-compactions",
+    "rocksdb.num-running-flushes",
+    "rocksdb.compaction-pending",
+    "rocksdb.total-sst-files-size",
+    "rocksdb.total-blob-file-size",
+]
+
+
+def percentile(latencies: list, q: float) -> float:
+    return latencies[int(q * (len(latencies) - 1))] / 1000
+
+
+async def settle(db: rocksdb.RocksDB) -> dict:
+    """Wait for background flushes and compactions, then return the properties"""
+    while True:
+        properties = await db.getIntProperties(PROPERTIES)
+        if not (
+            properties.get("rocksdb.num-running-compactions")
+            or properties.get("rocksdb.num-running-flushes")
+            or properties.get("rocksdb.compaction-pending")
+        ):
+            return properties
+
+        await asyncio.sleep(0.1)
+
+
+async def run(args, blob: bool) -> dict:
+    rmtree(args.path, ignore_errors=True)
+
+    statistics = rocksdb.Statistics.CreateDBStatistics()
+    options = rocksdb.Options(
+        create_if_missing=True,
+        statistics=statistics,
+        write_buffer_size=64 << 20,
+        target_file_size_base=64 << 20,
+    )
+    if blob:
+        options.enable_blob_files = True
+        options.min_blob_size = args.min_blob_size
+        options.blob_file_size = 256 << 20
+        options.blob_compression_type = rocksdb.CompressionType.lz4
+        options.enable_blob_garbage_collection = True
+        options.blob_cache = rocksdb.Cache.NewLRUCache(args.cache_size)
+
+    rng = Random(0)
+    # Random bytes, so compression does not hide the cost of rewriting the values
+    value = urandom(args.value_size)
+    keys = [f"key-{i:012d}".encode() for i in range(args.keys)]
+
+    async with rocksdb.RocksDB(args.path, options, workers=4) as db:
+        write_options = rocksdb.WriteOptions()
+
+        start = perf_counter()
+        for _ in range(args.rounds):
+            order = keys[:]
+            rng.shuffle(order)
+            for key in order:
+                response = await db.put(write_options, key, value)
+                assert response.status.ok, response.status
+
+        await db.flush(rocksdb.FlushOptions())
+        properties = await settle(db)
+        write_time = perf_counter() - start
+
+        user_bytes = statistics.GetTickerCount("rocksdb.bytes.written")
+        written = statistics.GetTickerCount(
+            "rocksdb.flush.write.bytes"
+        ) + statistics.GetTickerCount("rocksdb.compact.write.bytes")
+
+        read_options = rocksdb.ReadOptions()
+        latencies = []
+        for _ in range(args.reads):
+            key = keys[rng.randrange(args.keys)]
+
+            start = perf_counter_ns()
+            response = await db.get(read_options, key)
+            latencies.append(perf_counter_ns() - start)
+            assert response.status.ok, response.status
+
+        latencies.sort()
+
+    rmtree(args.path, ignore_errors=True)
+
+    return {
+        "write_time": write_time,
+        "write_amplification": written / user_bytes if user_bytes else 0,
+        "disk_size": properties.get("rocksdb.total-sst-files-size", 0)
+        + properties.get("rocksdb.total-blob-file-size", 0),
+        "get_p50": percentile(latencies, 0.5),
+        "get_p99": percentile(latencies, 0.99),
+        "get_p999": percentile(latencies, 0.999),
+    }
+
+
+async def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--keys", type=int, default=2000)
+    parser.add_argument("--value-size", type=int, default=100_000)
+    parser.add_argument("--rounds", type=int, default=3)
+    parser.add_argument("--reads", type=int, default=10_000)
+    parser.add_argument("--min-blob-size", type=int, default=4096)
+    parser.add_argument("--cache-size", type=int, default=64 << 20)
+    args = parser.parse_args()
+
+    print(
+        f"{args.keys} keys x {args.value_size} bytes, {args.rounds} rounds, {args.reads} reads\n"
+        f"{'mode':>8} {'write s':>9} {'write amp':>10} {'disk MB':>9} "
+        f"{'get p50':>9} {'get p99':>9} {'get p999':>9}  (latency in us)"
+    )
+
+    for blob in (False, True):
+        result = await run(args, blob)
+        print(
+            f"{'blob' if blob else 'inline':>8} {result['write_time']:>9.2f} "
+            f"{result['write_amplification']:>10.2f} {result['disk_size'] / (1 << 20):>9.1f} "
+            f"{result['get_p50']:>9.1f} {result['get_p99']:>9.1f} {result['get_p999']:>9.1f}"
+        )
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
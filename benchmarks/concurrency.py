@@ -0,0 +1,67 @@
+"""Read throughput of `RocksDB.get` while scaling `workers` from 1 to the number of cores
+
+Usage:
+    python benchmarks/concurrency.py [--keys 100000] [--reads 200000] [--path /tmp/rocksdb-bench]
+"""
+
+from argparse import ArgumentParser
+from os import cpu_count
+from shutil import rmtree
+from time import perf_counter
+
+import rocksdb, asyncio
+
+
+async def fill(db_path: str, keys: int, value_size: int) -> None:
+    async with rocksdb.RocksDB(
+        db_path, rocksdb.Options(create_if_missing=True)
+    ) as db:
+        value = "x" * value_size
+        options = rocksdb.WriteOptions(disableWAL=True)
+        for i in range(keys):
+            await db.put(options, f"key-{i:012d}", value)
+
+        await db.flush(rocksdb.FlushOptions())
+
+
+async def read(db_path: str, keys: int, reads: int, workers: int) -> float:
+    async with rocksdb.RocksDB(db_path, rocksdb.Options(), workers=workers) as db:
+        options = rocksdb.ReadOptions()
+        batch = workers * 64
+
+        start = perf_counter()
+        for offset in range(0, reads, batch):
+            await asyncio.gather(
+                *(
+                    db.get(options, f"key-{(offset + i) * 7919 % keys:012d}")
+                    for i in range(min(batch, reads - offset))
+                )
+            )
+
+        return reads / (perf_counter() - start)
+
+
+async def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--keys", type=int, default=100_000)
+    parser.add_argument("--reads", type=int, default=200_000)
+    parser.add_argument("--value-size", type=int, default=100)
+    parser.add_argument("--max-workers", type=int, default=cpu_count())
+    args = parser.parse_args()
+
+    rmtree(args.path, ignore_errors=True)
+    await fill(args.path, args.keys, args.value_size)
+
+    baseline = None
+    print(f"{'workers':>8} {'ops/sec':>12} {'speedup':>8}")
+    for workers in range(1, args.max_workers + 1):
+        ops = await read(args.path, args.keys, args.reads, workers)
+        baseline = baseline or ops
+        print(f"{workers:>8} {ops:>12.0f} {ops / baseline:>7.2f}x")
+
+    rmtree(args.path, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -0,0 +1,452 @@
+"""db_bench-style suite: fillseq, fillrandom, readrandom, readwhilewriting, seekrandom and mergerandom
+
+Every benchmark runs through `RocksDBext` directly ("ext") and through the async `RocksDB` client ("client"),
+sweeping workers, value sizes and batch sizes. With `--native` the same sweep also runs on the C++ baseline
+(benchmarks/native/db_bench.cpp, built with -DBUILD_BENCHMARKS=ON) so the wrapper overhead can be told apart
+from RocksDB itself.
+
+Results are written as JSON: ops/sec, latency percentiles per call in microseconds (a call covers `batch_size`
+keys) and an estimate of how long the GIL was held, measured by a probe thread that sleeps in a loop and records
+how late it wakes up.
+
+Usage:
+    python benchmarks/db_bench.py [--benchmarks fillseq,readrandom] [--modes ext,client] [--workers 1,4]
+        [--value-sizes 100,1000] [--batch-sizes 1,100] [--num 100000] [--tmpfs]
+        [--native build/db_bench_native] [--disable-wal] [--sync] [--output results.json]
+
+The measured writes of every mode (including the readwhilewriting background writer) use the same WriteOptions,
+built from `--disable-wal` and `--sync`. The prefill of read benchmarks never writes the WAL, on both sides.
+"""
+
+from argparse import ArgumentParser
+from concurrent.futures import ThreadPoolExecutor
+from itertools import product
+from json import dumps, loads
+from os import path as os_path
+from random import Random
+from shutil import rmtree
+from subprocess import check_output
+from threading import Event, Thread
+from time import perf_counter, perf_counter_ns, sleep
+
+from rocksdb.rocksdb_ext import RocksDBext, _Iterator
+
+import rocksdb, asyncio
+
+BENCHMARKS = [
+    "fillseq",
+    "fillrandom",
+    "readrandom",
+    "readwhilewriting",
+    "seekrandom",
+    "mergerandom",
+]
+READS = {"readrandom", "readwhilewriting", "seekrandom"}
+MODES = ["ext", "client"]
+TMPFS = "/dev/shm/rocksdb-python-bench"
+ONE = rocksdb.MergeOperator.EncodeUInt64(1)
+
+
+def key(i: int) -> bytes:
+    return b"key-%012d" % i
+
+
+def percentiles(latencies: list) -> dict:
+    latencies.sort()
+    if not latencies:
+        return {"p50": 0, "p99": 0, "p999": 0}
+
+    def at(q: float) -> float:
+        return round(latencies[int(q * (len(latencies) - 1))] / 1000, 2)
+
+    return {"p50": at(0.5), "p99": at(0.99), "p999": at(0.999)}
+
+
+def options() -> rocksdb.Options:
+    return rocksdb.Options(
+        create_if_missing=True, merge_operator=rocksdb.MergeOperator.UInt64Add()
+    )
+
+
+def measured_write_options(args) -> rocksdb.WriteOptions:
+    """Options of the measured writes, WriteOptionsFor in db_bench.cpp builds the same ones"""
+    return rocksdb.WriteOptions(disableWAL=args.disable_wal, sync=args.sync)
+
+
+class GilProbe:
+    """Sleeps `interval` in a loop, waking up late means another thread held the GIL"""
+
+    def __init__(self, interval: float = 0.0005) -> None:
+        self.interval = interval
+        self.baseline = 0.0
+        self.waits = []
+        self.__stop = Event()
+        self.__thread = None
+
+    def __run(self) -> None:
+        while not self.__stop.is_set():
+            start = perf_counter()
+            sleep(self.interval)
+            self.waits.append(perf_counter() - start - self.interval)
+
+    def calibrate(self) -> None:
+        """Measure the oversleep of the OS timer alone, subtracted from every sample"""
+        with self:
+            sleep(0.2)
+
+        self.waits.sort()
+        self.baseline = self.waits[len(self.waits) // 2] if self.waits else 0.0
+
+    def __enter__(self):
+        self.waits = []
+        self.__stop.clear()
+        self.__thread = Thread(target=self.__run, daemon=True)
+        self.__thread.start()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.__stop.set()
+        self.__thread.join()
+
+    def report(self, elapsed: float, ops: int) -> dict:
+        waits = [max(0.0, wait - self.baseline) for wait in self.waits]
+        held = sum(waits)
+        waits.sort()
+
+        return {
+            "held_fraction": round(min(1.0, held / elapsed), 4) if elapsed else 0,
+            "hold_per_op_us": round(held / ops * 1e6, 3) if ops else 0,
+            "wait_p99_us": round(waits[int(0.99 * (len(waits) - 1))] * 1e6, 2)
+            if waits
+            else 0,
+        }
+
+
+def partition(count: int, workers: int, worker: int) -> range:
+    return range(worker * count // workers, (worker + 1) * count // workers)
+
+
+def prefill(db_path: str, num: int, value_size: int) -> None:
+    db = RocksDBext(db_path, options())
+    value = b"x" * value_size
+    # Same as Prefill in db_bench.cpp
+    write_options = rocksdb.WriteOptions(disableWAL=True)
+    for start in range(0, num, 10_000):
+        batch = rocksdb.WriteBatch()
+        batch.PutMany([(key(i), value) for i in range(start, min(num, start + 10_000))])
+        db.Write(write_options, batch)
+
+    db.Flush(rocksdb.FlushOptions())
+    db.Close()
+
+
+def ext_calls(db: RocksDBext, benchmark: str, args, worker: int, workers: int):
+    """Yields callables doing one call each, they return the number of keys they covered"""
+    rng = Random(worker)
+    value = b"x" * args.value_size
+    read_options = rocksdb.ReadOptions()
+    write_options = measured_write_options(args)
+    batch_size = args.batch_size
+
+    if benchmark in ("fillseq", "fillrandom", "mergerandom"):
+        keys = [key(i) for i in partition(args.num, workers, worker)]
+        if benchmark != "fillseq":
+            rng.shuffle(keys)
+
+        for offset in range(0, len(keys), batch_size):
+            chunk = keys[offset : offset + batch_size]
+
+            def write(chunk=chunk):
+                if batch_size == 1 and benchmark == "mergerandom":
+                    db.Merge(write_options, chunk[0], ONE)
+                elif batch_size == 1:
+                    db.Put(write_options, chunk[0], value)
+                else:
+                    batch = rocksdb.WriteBatch()
+                    if benchmark == "mergerandom":
+                        for k in chunk:
+                            batch.Merge(k, ONE)
+                    else:
+                        batch.PutMany([(k, value) for k in chunk])
+                    db.Write(write_options, batch)
+
+                return len(chunk)
+
+            yield write
+    elif benchmark == "seekrandom":
+        iterator = _Iterator(db, read_options)
+        for _ in partition(args.reads, workers, worker):
+            k = key(rng.randrange(args.num))
+
+            def seek(k=k):
+                iterator.Seek(k)
+                iterator.Chunk(args.seek_nexts)
+                return 1
+
+            yield seek
+        iterator.Close()
+    else:
+        reads = len(partition(args.reads, workers, worker))
+        for _ in range(0, reads, batch_size):
+            keys = [key(rng.randrange(args.num)) for _ in range(batch_size)]
+
+            def read(keys=keys):
+                if batch_size == 1:
+                    db.Get(read_options, keys[0])
+                else:
+                    db.MultiGet(read_options, keys)
+
+                return len(keys)
+
+            yield read
+
+
+def writer(db, args, stop: Event) -> None:
+    """Background writes for readwhilewriting"""
+    rng = Random(-1)
+    value = b"x" * args.value_size
+    write_options = measured_write_options(args)
+    while not stop.is_set():
+        db.Put(write_options, key(rng.randrange(args.num)), value)
+
+
+def run_ext(db_path: str, benchmark: str, args, workers: int) -> tuple:
+    db = RocksDBext(db_path, options())
+
+    def work(worker: int) -> tuple:
+        latencies = []
+        ops = 0
+        for call in ext_calls(db, benchmark, args, worker, workers):
+            start = perf_counter_ns()
+            ops += call()
+            latencies.append(perf_counter_ns() - start)
+
+        return ops, latencies
+
+    stop = Event()
+    background = None
+    if benchmark == "readwhilewriting":
+        background = Thread(target=writer, args=(db, args, stop), daemon=True)
+        background.start()
+
+    with ThreadPoolExecutor(workers) as executor:
+        start = perf_counter()
+        results = list(executor.map(work, range(workers)))
+        elapsed = perf_counter() - start
+
+    stop.set()
+    if background is not None:
+        background.join()
+    db.Close()
+
+    latencies = [latency for _, worker_latencies in results for latency in worker_latencies]
+    return sum(ops for ops, _ in results), elapsed, latencies
+
+
+async def run_client(db_path: str, benchmark: str, args, workers: int) -> tuple:
+    value = b"x" * args.value_size
+    read_options = rocksdb.ReadOptions()
+    write_options = measured_write_options(args)
+    batch_size = args.batch_size
+    latencies = []
+
+    async with rocksdb.RocksDB(db_path, options(), workers=workers) as db:
+
+        async def timed(coroutine, ops: int) -> int:
+            start = perf_counter_ns()
+            await coroutine
+            latencies.append(perf_counter_ns() - start)
+            return ops
+
+        async def work(worker: int) -> int:
+            rng = Random(worker)
+            ops = 0
+
+            if benchmark in ("fillseq", "fillrandom", "mergerandom"):
+                keys = [key(i) for i in partition(args.num, workers, worker)]
+                if benchmark != "fillseq":
+                    rng.shuffle(keys)
+
+                for offset in range(0, len(keys), batch_size):
+                    chunk = keys[offset : offset + batch_size]
+                    if batch_size == 1 and benchmark == "mergerandom":
+                        ops += await timed(db.merge(write_options, chunk[0], ONE), 1)
+                    elif batch_size == 1:
+                        ops += await timed(db.put(write_options, chunk[0], value), 1)
+                    else:
+                        batch = rocksdb.WriteBatch()
+                        if benchmark == "mergerandom":
+                            for k in chunk:
+                                batch.Merge(k, ONE)
+                        else:
+                            batch.PutMany([(k, value) for k in chunk])
+                        ops += await timed(db.write(write_options, batch), len(chunk))
+            elif benchmark == "seekrandom":
+                async with db.iterator(read_options, chunk_size=args.seek_nexts) as it:
+                    for _ in partition(args.reads, workers, worker):
+
+                        async def seek():
+                            await it.seek(key(rng.randrange(args.num)))
+                            for _ in range(args.seek_nexts):
+                                try:
+                                    await it.__anext__()
+                                except StopAsyncIteration:
+                                    break
+
+                        ops += await timed(seek(), 1)
+            else:
+                reads = len(partition(args.reads, workers, worker))
+                for _ in range(0, reads, batch_size):
+                    if batch_size == 1:
+                        k = key(rng.randrange(args.num))
+                        ops += await timed(db.get(read_options, k), 1)
+                    else:
+                        keys = [key(rng.randrange(args.num)) for _ in range(batch_size)]
+                        ops += await timed(db.multiGet(read_options, keys), batch_size)
+
+            return ops
+
+        async def write_forever():
+            rng = Random(-1)
+            while True:
+                await db.put(write_options, key(rng.randrange(args.num)), value)
+
+        background = None
+        if benchmark == "readwhilewriting":
+            background = asyncio.ensure_future(write_forever())
+
+        start = perf_counter()
+        ops = sum(await asyncio.gather(*(work(worker) for worker in range(workers))))
+        elapsed = perf_counter() - start
+
+        if background is not None:
+            background.cancel()
+            try:
+                await background
+            except asyncio.CancelledError:
+                pass
+
+    return ops, elapsed, latencies
+
+
+def run_native(binary: str, db_path: str, benchmark: str, args, workers: int) -> dict:
+    output = check_output(
+        [
+            binary,
+            f"--benchmark={benchmark}",
+            f"--path={db_path}",
+            f"--workers={workers}",
+            f"--value-size={args.value_size}",
+            f"--batch-size={args.batch_size}",
+            f"--num={args.num}",
+            f"--reads={args.reads}",
+            f"--seek-nexts={args.seek_nexts}",
+            f"--disable-wal={int(args.disable_wal)}",
+            f"--sync={int(args.sync)}",
+        ]
+    )
+    return loads(output.decode().strip().splitlines()[-1])
+
+
+def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--tmpfs", action="store_true", help=f"Run in {TMPFS}")
+    parser.add_argument("--benchmarks", default=",".join(BENCHMARKS))
+    parser.add_argument("--modes", default=",".join(MODES))
+    parser.add_argument("--workers", default="1,4")
+    parser.add_argument("--value-sizes", default="100")
+    parser.add_argument("--batch-sizes", default="1,100")
+    parser.add_argument("--num", type=int, default=100_000)
+    parser.add_argument("--reads", type=int, default=None)
+    parser.add_argument("--seek-nexts", type=int, default=10)
+    parser.add_argument("--native", default=None, help="Path to db_bench_native")
+    parser.add_argument("--disable-wal", action="store_true", help="Measured writes skip the WAL")
+    parser.add_argument("--sync", action="store_true", help="Measured writes fsync the WAL")
+    parser.add_argument("--output", default=None)
+    args = parser.parse_args()
+
+    db_path = TMPFS if args.tmpfs else args.path
+    if args.tmpfs and not os_path.isdir(os_path.dirname(TMPFS)):
+        parser.error(f"{os_path.dirname(TMPFS)} does not exist")
+    args.reads = args.reads or args.num
+
+    modes = args.modes.split(",") + (["native"] if args.native else [])
+    probe = GilProbe()
+    probe.calibrate()
+    results = []
+
+    for benchmark, mode, workers, value_size, batch_size in product(
+        args.benchmarks.split(","),
+        modes,
+        [int(w) for w in args.workers.split(",")],
+        [int(v) for v in args.value_sizes.split(",")],
+        [int(b) for b in args.batch_sizes.split(",")],
+    ):
+        # Seeks are not batched
+        if benchmark == "seekrandom" and batch_size != 1:
+            continue
+
+        args.value_size = value_size
+        args.batch_size = batch_size
+        rmtree(db_path, ignore_errors=True)
+
+        if mode == "native":
+            result = run_native(args.native, db_path, benchmark, args, workers)
+        else:
+            if benchmark in READS:
+                prefill(db_path, args.num, value_size)
+
+            with probe:
+                if mode == "ext":
+                    ops, elapsed, latencies = run_ext(db_path, benchmark, args, workers)
+                else:
+                    ops, elapsed, latencies = asyncio.run(
+                        run_client(db_path, benchmark, args, workers)
+                    )
+
+            result = {
+                "benchmark": benchmark,
+                "mode": mode,
+                "workers": workers,
+                "value_size": value_size,
+                "batch_size": batch_size,
+                "ops": ops,
+                "seconds": round(elapsed, 4),
+                "ops_per_sec": round(ops / elapsed, 1),
+                "latency_us": percentiles(latencies),
+                "gil": probe.report(elapsed, ops),
+            }
+
+        results.append(result)
+        print(
+            f"{benchmark:>16} {mode:>7} workers={workers:<3} value={value_size:<6} "
+            f"batch={batch_size:<5} {result['ops_per_sec']:>12.0f} ops/sec "
+            f"p99={result['latency_us']['p99']}us"
+        )
+
+    rmtree(db_path, ignore_errors=True)
+
+    report = dumps(
+        {
+            "rocksdb": rocksdb.getRocksVersion(),
+            "path": db_path,
+            "tmpfs": args.tmpfs,
+            "num": args.num,
+            "reads": args.reads,
+            "disable_wal": args.disable_wal,
+            "sync": args.sync,
+            "results": results,
+        },
+        indent=4,
+    )
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(report)
+    else:
+        print(report)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,55 @@
+"""Per-op overhead of a cached `RocksDBext.Get` compared to an empty native call
+
+Usage:
+    python benchmarks/get_overhead.py [--ops 1000000] [--path /tmp/rocksdb-bench]
+"""
+
+from argparse import ArgumentParser
+from shutil import rmtree
+from time import perf_counter_ns
+
+from rocksdb.rocksdb_ext import RocksDBext
+import rocksdb
+
+
+def measure(func, ops: int) -> float:
+    start = perf_counter_ns()
+    for _ in range(ops):
+        func()
+    return (perf_counter_ns() - start) / ops
+
+
+def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--ops", type=int, default=1_000_000)
+    parser.add_argument("--value-size", type=int, default=100)
+    args = parser.parse_args()
+
+    rmtree(args.path, ignore_errors=True)
+
+    db = RocksDBext(args.path, rocksdb.Options(create_if_missing=True), False, None)
+    db.Put(rocksdb.WriteOptions(), "hit", "x" * args.value_size)
+    db.Flush(rocksdb.FlushOptions())
+
+    options = rocksdb.ReadOptions()
+    write_options = rocksdb.WriteOptions(disableWAL=True)
+    db.Get(options, "hit")  # warm the block cache
+
+    results = {
+        "empty native call": measure(RocksDBext.GetRocksVersionAsString, args.ops),
+        "Get (hit)": measure(lambda: db.Get(options, "hit"), args.ops),
+        "Get (hit) + status.ok": measure(lambda: db.Get(options, "hit").status.ok, args.ops),
+        "Get (miss)": measure(lambda: db.Get(options, "miss"), args.ops),
+        "Put": measure(lambda: db.Put(write_options, "hit", "y"), args.ops // 10),
+    }
+
+    for name, ns in results.items():
+        print(f"{name:>24}: {ns:>8.0f} ns/op")
+
+    db.Close()
+    rmtree(args.path, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,115 @@
+"""Bulk loading with `SstFileWriter.Generate` + `RocksDB.ingestExternalFile` against per-key `RocksDB.put`
+(and `WriteBatch` writes of `--batch-size` keys)
+
+Usage:
+    python benchmarks/ingest.py [--keys 1000000] [--threads 4] [--chunk-size 1000000] [--path /tmp/rocksdb-bench]
+"""
+
+from argparse import ArgumentParser
+from os import cpu_count, makedirs
+from random import Random
+from shutil import rmtree
+from time import perf_counter
+
+import rocksdb, asyncio
+
+
+async def put_path(db_path: str, items: list) -> float:
+    rmtree(db_path, ignore_errors=True)
+
+    start = perf_counter()
+    async with rocksdb.RocksDB(
+        db_path, rocksdb.Options(create_if_missing=True)
+    ) as db:
+        options = rocksdb.WriteOptions()
+        for key, value in items:
+            response = await db.put(options, key, value)
+            assert response.status.ok, response.status
+
+        await db.flush(rocksdb.FlushOptions())
+
+    return perf_counter() - start
+
+
+async def batch_path(db_path: str, items: list, batch_size: int) -> float:
+    rmtree(db_path, ignore_errors=True)
+
+    start = perf_counter()
+    async with rocksdb.RocksDB(
+        db_path, rocksdb.Options(create_if_missing=True)
+    ) as db:
+        options = rocksdb.WriteOptions()
+        for i in range(0, len(items), batch_size):
+            batch = rocksdb.WriteBatch()
+            batch.PutMany(items[i : i + batch_size])
+            response = await db.write(options, batch)
+            assert response.status.ok, response.status
+
+        await db.flush(rocksdb.FlushOptions())
+
+    return perf_counter() - start
+
+
+async def ingest_path(db_path: str, items: list, threads: int, chunk_size: int) -> float:
+    rmtree(db_path, ignore_errors=True)
+    sst_path = db_path + "-sst"
+    rmtree(sst_path, ignore_errors=True)
+    makedirs(sst_path)
+
+    start = perf_counter()
+    async with rocksdb.RocksDB(
+        db_path, rocksdb.Options(create_if_missing=True)
+    ) as db:
+        # A generator, like a nightly rebuild reading its source would pass
+        response = await asyncio.get_running_loop().run_in_executor(
+            None,
+            rocksdb.SstFileWriter.Generate,
+            rocksdb.Options(),
+            (item for item in items),
+            sst_path + "/part-",
+            threads,
+            True,
+            chunk_size,
+        )
+        assert response.status.ok, response.status
+
+        response = await db.ingestExternalFile(
+            rocksdb.IngestExternalFileOptions(move_files=True), response.file_paths
+        )
+        assert response.status.ok, response.status
+
+    elapsed = perf_counter() - start
+    rmtree(sst_path, ignore_errors=True)
+
+    return elapsed
+
+
+async def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--keys", type=int, default=1_000_000)
+    parser.add_argument("--value-size", type=int, default=100)
+    parser.add_argument("--batch-size", type=int, default=1000)
+    parser.add_argument("--threads", type=int, default=cpu_count())
+    parser.add_argument("--chunk-size", type=int, default=1_000_000)
+    args = parser.parse_args()
+
+    value = b"x" * args.value_size
+    items = [(f"key-{i:012d}".encode(), value) for i in range(args.keys)]
+    Random(0).shuffle(items)
+
+    put_time = await put_path(args.path, items)
+    batch_time = await batch_path(args.path, items, args.batch_size)
+    ingest_time = await ingest_path(args.path, items, args.threads, args.chunk_size)
+
+    print(f"{'path':>8} {'seconds':>10} {'keys/sec':>12} {'vs put':>8}")
+    for name, elapsed in (("put", put_time), ("batch", batch_time), ("ingest", ingest_time)):
+        print(
+            f"{name:>8} {elapsed:>10.2f} {args.keys / elapsed:>12.0f} {put_time / elapsed:>7.2f}x"
+        )
+
+    rmtree(args.path, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -0,0 +1,71 @@
+"""`RocksDB.multiGet` against a loop of `RocksDB.get` for batch sizes from 1 to 10k
+
+Usage:
+    python benchmarks/multi_get.py [--keys 100000] [--path /tmp/rocksdb-bench]
+"""
+
+from argparse import ArgumentParser
+from shutil import rmtree
+from time import perf_counter
+
+import rocksdb, asyncio
+
+BATCH_SIZES = [1, 10, 100, 1000, 10_000]
+
+
+async def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--keys", type=int, default=100_000)
+    parser.add_argument("--value-size", type=int, default=100)
+    parser.add_argument("--lookups", type=int, default=100_000)
+    parser.add_argument("--async-io", action="store_true")
+    args = parser.parse_args()
+
+    rmtree(args.path, ignore_errors=True)
+
+    async with rocksdb.RocksDB(
+        args.path, rocksdb.Options(create_if_missing=True)
+    ) as db:
+        value = "x" * args.value_size
+        write_options = rocksdb.WriteOptions(disableWAL=True)
+        for i in range(args.keys):
+            await db.put(write_options, f"key-{i:012d}", value)
+
+        await db.flush(rocksdb.FlushOptions())
+
+        read_options = rocksdb.ReadOptions(
+            async_io=args.async_io, optimize_multiget_for_io=args.async_io
+        )
+
+        print(f"{'batch':>8} {'get ops/sec':>14} {'multiGet ops/sec':>18} {'speedup':>8}")
+        for batch_size in BATCH_SIZES:
+            batches = [
+                [
+                    f"key-{(b * batch_size + i) * 7919 % args.keys:012d}"
+                    for i in range(batch_size)
+                ]
+                for b in range(max(1, args.lookups // batch_size))
+            ]
+            total = len(batches) * batch_size
+
+            start = perf_counter()
+            for keys in batches:
+                for key in keys:
+                    await db.get(read_options, key)
+            get_ops = total / (perf_counter() - start)
+
+            start = perf_counter()
+            for keys in batches:
+                await db.multiGet(read_options, keys)
+            multi_get_ops = total / (perf_counter() - start)
+
+            print(
+                f"{batch_size:>8} {get_ops:>14.0f} {multi_get_ops:>18.0f} {multi_get_ops / get_ops:>7.2f}x"
+            )
+
+    rmtree(args.path, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -0,0 +1,354 @@
+// Native baseline for benchmarks/db_bench.py: the same workloads on the C++ API with one std::thread per worker,
+// printing one JSON result in the schema of db_bench.py (without the GIL estimate).
+//
+// Build with `cmake -DBUILD_BENCHMARKS=ON`, then:
+//     db_bench_native --benchmark=readrandom --path=/tmp/rocksdb-python-bench --workers=4 --value-size=100
+//         --batch-size=1 --num=100000 --reads=100000 --seek-nexts=10 --disable-wal=0 --sync=0
+
+#include <rocksdb/db.h>
+#include <rocksdb/merge_operator.h>
+#include <rocksdb/write_batch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Same encoding as MergeOperator.UInt64Add so both sides merge the same operands
+class UInt64AddOperator : public rocksdb::AssociativeMergeOperator {
+   public:
+    static std::string Encode(uint64_t value) {
+        std::string encoded(sizeof(uint64_t), '\0');
+        for (size_t i = 0; i < sizeof(uint64_t); i++) {
+            encoded[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+        }
+
+        return encoded;
+    }
+
+    static uint64_t Decode(const rocksdb::Slice &value) {
+        if (value.size() != sizeof(uint64_t)) {
+            return 0;
+        }
+
+        uint64_t decoded = 0;
+        for (size_t i = 0; i < sizeof(uint64_t); i++) {
+            decoded |= static_cast<uint64_t>(static_cast<unsigned char>(value[i])) << (i * 8);
+        }
+
+        return decoded;
+    }
+
+    bool Merge(const rocksdb::Slice &, const rocksdb::Slice *existing_value, const rocksdb::Slice &value,
+               std::string *new_value, rocksdb::Logger *) const override {
+        uint64_t existing = existing_value == nullptr ? 0 : Decode(*existing_value);
+        *new_value = Encode(existing + Decode(value));
+        return true;
+    }
+
+    const char *Name() const override {
+        return "UInt64AddOperator";
+    }
+};
+
+struct Config {
+    std::string benchmark = "fillseq";
+    std::string path = "/tmp/rocksdb-python-bench";
+    size_t workers = 1;
+    size_t value_size = 100;
+    size_t batch_size = 1;
+    size_t num = 100000;
+    size_t reads = 0;
+    size_t seek_nexts = 10;
+    bool disable_wal = false;
+    bool sync = false;
+};
+
+struct WorkerResult {
+    uint64_t ops = 0;
+    std::vector<uint64_t> latencies;
+};
+
+std::string Key(uint64_t i) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "key-%012llu", static_cast<unsigned long long>(i));
+    return buffer;
+}
+
+// First and last key of `worker` share in `count`, same split as db_bench.py
+std::pair<size_t, size_t> Partition(size_t count, size_t workers, size_t worker) {
+    return {worker * count / workers, (worker + 1) * count / workers};
+}
+
+void Check(const rocksdb::Status &s) {
+    if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+}
+
+Config Parse(int argc, char **argv) {
+    std::map<std::string, std::string> flags;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t equal = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || equal == std::string::npos) {
+            throw std::invalid_argument("Invalid argument '" + arg + "', expected --name=value");
+        }
+
+        flags[arg.substr(2, equal - 2)] = arg.substr(equal + 1);
+    }
+
+    Config config;
+    for (auto &[name, value] : flags) {
+        if (name == "benchmark") {
+            config.benchmark = value;
+        } else if (name == "path") {
+            config.path = value;
+        } else if (name == "workers") {
+            config.workers = std::stoul(value);
+        } else if (name == "value-size") {
+            config.value_size = std::stoul(value);
+        } else if (name == "batch-size") {
+            config.batch_size = std::stoul(value);
+        } else if (name == "num") {
+            config.num = std::stoul(value);
+        } else if (name == "reads") {
+            config.reads = std::stoul(value);
+        } else if (name == "seek-nexts") {
+            config.seek_nexts = std::stoul(value);
+        } else if (name == "disable-wal") {
+            config.disable_wal = std::stoul(value) != 0;
+        } else if (name == "sync") {
+            config.sync = std::stoul(value) != 0;
+        } else {
+            throw std::invalid_argument("Unknown flag '--" + name + "'");
+        }
+    }
+
+    if (config.reads == 0) {
+        config.reads = config.num;
+    }
+    if (config.workers == 0 || config.batch_size == 0) {
+        throw std::invalid_argument("workers and batch-size must be greater than 0");
+    }
+
+    return config;
+}
+
+// Options of the measured writes, same as measured_write_options in db_bench.py
+rocksdb::WriteOptions WriteOptionsFor(const Config &config) {
+    rocksdb::WriteOptions write_options;
+    write_options.disableWAL = config.disable_wal;
+    write_options.sync = config.sync;
+
+    return write_options;
+}
+
+void Prefill(rocksdb::DB *db, const Config &config) {
+    std::string value(config.value_size, 'x');
+    // Same as prefill in db_bench.py
+    rocksdb::WriteOptions write_options;
+    write_options.disableWAL = true;
+
+    for (size_t start = 0; start < config.num; start += 10000) {
+        rocksdb::WriteBatch batch;
+        for (size_t i = start; i < std::min(config.num, start + 10000); i++) {
+            Check(batch.Put(Key(i), value));
+        }
+        Check(db->Write(write_options, &batch));
+    }
+
+    Check(db->Flush(rocksdb::FlushOptions()));
+}
+
+WorkerResult Work(rocksdb::DB *db, const Config &config, size_t worker) {
+    WorkerResult result;
+    std::mt19937_64 rng(worker);
+    std::uniform_int_distribution<uint64_t> random_key(0, config.num - 1);
+    std::string value(config.value_size, 'x');
+    std::string one = UInt64AddOperator::Encode(1);
+    rocksdb::ReadOptions read_options;
+    rocksdb::WriteOptions write_options = WriteOptionsFor(config);
+
+    auto timed = [&result](auto &&call) {
+        auto start = std::chrono::steady_clock::now();
+        result.ops += call();
+        auto latency = std::chrono::steady_clock::now() - start;
+        result.latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+    };
+
+    const std::string &benchmark = config.benchmark;
+    if (benchmark == "fillseq" || benchmark == "fillrandom" || benchmark == "mergerandom") {
+        auto [first, last] = Partition(config.num, config.workers, worker);
+        std::vector<std::string> keys;
+        keys.reserve(last - first);
+        for (size_t i = first; i < last; i++) {
+            keys.push_back(Key(i));
+        }
+        if (benchmark != "fillseq") {
+            std::shuffle(keys.begin(), keys.end(), rng);
+        }
+
+        bool merge = benchmark == "mergerandom";
+        for (size_t offset = 0; offset < keys.size(); offset += config.batch_size) {
+            size_t end = std::min(keys.size(), offset + config.batch_size);
+            timed([&] {
+                if (end - offset == 1 && config.batch_size == 1) {
+                    Check(merge ? db->Merge(write_options, keys[offset], one)
+                                : db->Put(write_options, keys[offset], value));
+                } else {
+                    rocksdb::WriteBatch batch;
+                    for (size_t i = offset; i < end; i++) {
+                        Check(merge ? batch.Merge(keys[i], one) : batch.Put(keys[i], value));
+                    }
+                    Check(db->Write(write_options, &batch));
+                }
+
+                return end - offset;
+            });
+        }
+    } else if (benchmark == "seekrandom") {
+        auto [first, last] = Partition(config.reads, config.workers, worker);
+        std::unique_ptr<rocksdb::Iterator> iterator(db->NewIterator(read_options));
+        for (size_t i = first; i < last; i++) {
+            std::string key = Key(random_key(rng));
+            timed([&] {
+                iterator->Seek(key);
+                for (size_t n = 0; n < config.seek_nexts && iterator->Valid(); n++) {
+                    // Copy like the binding does when it builds a chunk
+                    std::string k = iterator->key().ToString();
+                    std::string v = iterator->value().ToString();
+                    iterator->Next();
+                }
+                Check(iterator->status());
+                return 1;
+            });
+        }
+    } else if (benchmark == "readrandom" || benchmark == "readwhilewriting") {
+        auto [first, last] = Partition(config.reads, config.workers, worker);
+        for (size_t done = first; done < last; done += config.batch_size) {
+            std::vector<std::string> keys(config.batch_size);
+            for (auto &key : keys) {
+                key = Key(random_key(rng));
+            }
+
+            timed([&] {
+                if (config.batch_size == 1) {
+                    rocksdb::PinnableSlice result;
+                    rocksdb::Status s = db->Get(read_options, db->DefaultColumnFamily(), keys[0], &result);
+                    if (!s.ok() && !s.IsNotFound()) {
+                        Check(s);
+                    }
+                } else {
+                    std::vector<rocksdb::Slice> slices(keys.begin(), keys.end());
+                    std::vector<rocksdb::PinnableSlice> values(slices.size());
+                    std::vector<rocksdb::Status> statuses(slices.size());
+                    db->MultiGet(read_options, db->DefaultColumnFamily(), slices.size(), slices.data(),
+                                 values.data(), statuses.data());
+                }
+
+                return keys.size();
+            });
+        }
+    } else {
+        throw std::invalid_argument("Unknown benchmark '" + benchmark + "'");
+    }
+
+    return result;
+}
+
+double Percentile(const std::vector<uint64_t> &sorted, double q) {
+    if (sorted.empty()) {
+        return 0;
+    }
+
+    return sorted[static_cast<size_t>(q * (sorted.size() - 1))] / 1000.0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    try {
+        Config config = Parse(argc, argv);
+
+        rocksdb::Options options;
+        options.create_if_missing = true;
+        options.merge_operator = std::make_shared<UInt64AddOperator>();
+        Check(rocksdb::DestroyDB(config.path, options));
+
+        rocksdb::DB *raw_db;
+        Check(rocksdb::DB::Open(options, config.path, &raw_db));
+        std::unique_ptr<rocksdb::DB> db(raw_db);
+
+        if (config.benchmark == "readrandom" || config.benchmark == "readwhilewriting" ||
+            config.benchmark == "seekrandom") {
+            Prefill(db.get(), config);
+        }
+
+        std::atomic<bool> stop = false;
+        std::thread writer;
+        if (config.benchmark == "readwhilewriting") {
+            writer = std::thread([&] {
+                std::mt19937_64 rng(-1);
+                std::uniform_int_distribution<uint64_t> random_key(0, config.num - 1);
+                std::string value(config.value_size, 'x');
+                rocksdb::WriteOptions write_options = WriteOptionsFor(config);
+                while (!stop) {
+                    Check(db->Put(write_options, Key(random_key(rng)), value));
+                }
+            });
+        }
+
+        std::vector<WorkerResult> results(config.workers);
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t worker = 0; worker < config.workers; worker++) {
+            threads.emplace_back([&, worker] { results[worker] = Work(db.get(), config, worker); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        stop = true;
+        if (writer.joinable()) {
+            writer.join();
+        }
+
+        uint64_t ops = 0;
+        std::vector<uint64_t> latencies;
+        for (auto &result : results) {
+            ops += result.ops;
+            latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        Check(db->Close());
+        db.reset();
+        rocksdb::DestroyDB(config.path, options);
+
+        std::printf(
+            "{\"benchmark\": \"%s\", \"mode\": \"native\", \"workers\": %zu, \"value_size\": %zu, "
+            "\"batch_size\": %zu, \"ops\": %llu, \"seconds\": %.4f, \"ops_per_sec\": %.1f, "
+            "\"latency_us\": {\"p50\": %.2f, \"p99\": %.2f, \"p999\": %.2f}}\n",
+            config.benchmark.c_str(), config.workers, config.value_size, config.batch_size,
+            static_cast<unsigned long long>(ops), seconds, seconds > 0 ? ops / seconds : 0.0,
+            Percentile(latencies, 0.5), Percentile(latencies, 0.99), Percentile(latencies, 0.999));
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
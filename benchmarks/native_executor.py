@@ -0,0 +1,63 @@
+"""`RocksDB.get` throughput on the `ThreadPoolExecutor` path against the `NativeExecutor` path
+
+Usage:
+    python benchmarks/native_executor.py [--reads 500000] [--concurrency 256] [--path /tmp/rocksdb-bench]
+"""
+
+from argparse import ArgumentParser
+from os import cpu_count
+from shutil import rmtree
+from time import perf_counter
+
+import rocksdb, asyncio
+
+
+async def run(args, native_executor: bool) -> float:
+    async with rocksdb.RocksDB(
+        args.path,
+        rocksdb.Options(create_if_missing=True),
+        workers=args.workers,
+        native_executor=native_executor,
+    ) as db:
+        options = rocksdb.ReadOptions()
+        keys = [f"key-{i * 7919 % args.keys:012d}" for i in range(args.reads)]
+
+        start = perf_counter()
+        for offset in range(0, args.reads, args.concurrency):
+            await asyncio.gather(
+                *(db.get(options, key) for key in keys[offset : offset + args.concurrency])
+            )
+
+        return args.reads / (perf_counter() - start)
+
+
+async def main() -> None:
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--path", default="/tmp/rocksdb-python-bench")
+    parser.add_argument("--keys", type=int, default=100_000)
+    parser.add_argument("--reads", type=int, default=500_000)
+    parser.add_argument("--concurrency", type=int, default=256)
+    parser.add_argument("--workers", type=int, default=cpu_count())
+    args = parser.parse_args()
+
+    rmtree(args.path, ignore_errors=True)
+
+    async with rocksdb.RocksDB(
+        args.path, rocksdb.Options(create_if_missing=True), native_executor=True
+    ) as db:
+        batch = rocksdb.WriteBatch()
+        batch.PutMany([(f"key-{i:012d}", "x" * 100) for i in range(args.keys)])
+        await db.write(rocksdb.WriteOptions(), batch)
+        await db.flush(rocksdb.FlushOptions())
+
+    executor_ops = await run(args, False)
+    native_ops = await run(args, True)
+
+    print(f"ThreadPoolExecutor: {executor_ops:>12.0f} ops/sec")
+    print(f"NativeExecutor:     {native_ops:>12.0f} ops/sec ({native_ops / executor_ops:.2f}x)")
+
+    rmtree(args.path, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -5,9 +5,64 @@ __copyright__ = "Copyright (c) 2022-present AYMEN Mohammed ~ https://github.com/
 VERSION = __version__
 
 from typing import Union
-from .options import Options, ReadOptions, WriteOptions, FlushOptions
+from .options import (
+    Options,
+    ColumnFamilyOptions,
+    ReadOptions,
+    WriteOptions,
+    FlushOptions,
+    BlockBasedTableOptions,
+    IngestExternalFileOptions,
+    CompactRangeOptions,
+    CompactionOptions,
+    BackupEngineOptions,
+    TransactionDBOptions,
+    TransactionOptions,
+)
 from .client import RocksDB, NotSupported
-from .rocksdb_ext import Response, RocksDBext as __RocksDBext
+from .iterator import Iterator
+from .transaction import Transaction
+from .executor import NativeExecutor
+from .rocksdb_ext import (
+    Response,
+    MultiResponse,
+    OptionsResponse,
+    PropertiesResponse,
+    EntityResponse,
+    CatchUpStats,
+    Value,
+    ColumnFamily,
+    Snapshot,
+    Cache,
+    RateLimiter,
+    RateLimiterMode,
+    WriteBufferManager,
+    SstFileManager,
+    FilterPolicy,
+    IndexType,
+    Statistics,
+    StatsLevel,
+    PerfContext,
+    PerfLevel,
+    MergeOperator,
+    CompactionFilterFactory,
+    PrefixDropFilter,
+    BottommostLevelCompaction,
+    CompactionStyle,
+    CompressionType,
+    PrepopulateBlobCache,
+    SliceTransform,
+    WriteBatch,
+    WriteBatchWithIndex,
+    BackupEngine,
+    BackupInfo,
+    BackupResponse,
+    SstFileWriter,
+    SstFileResponse,
+    ExternalSstFileInfo,
+    TransactionDBType,
+    RocksDBext as __RocksDBext,
+)
 
 
 def getRocksVersion() -> str:
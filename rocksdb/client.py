@@ -1,14 +1,56 @@
-from .options import Options, ReadOptions, WriteOptions, FlushOptions
-from typing import Dict, Union
+from .options import (
+    Options,
+    ReadOptions,
+    WriteOptions,
+    FlushOptions,
+    ColumnFamilyOptions,
+    IngestExternalFileOptions,
+    CompactRangeOptions,
+    CompactionOptions,
+    TransactionDBOptions,
+    TransactionOptions,
+)
+from typing import AsyncGenerator, Callable, Dict, Generator, List, Tuple, Union
+from contextlib import asynccontextmanager, contextmanager
+from functools import partial
+from contextvars import ContextVar
 from pathlib import Path
 from logging import getLogger
 from concurrent.futures import ThreadPoolExecutor
-from .rocksdb_ext import RocksDBext, Response
+from .iterator import Iterator
+from .transaction import Transaction
+from .executor import NativeExecutor
+from .types import Binary, BINARY_TYPES, as_string
+from .rocksdb_ext import (
+    RocksDBext,
+    ColumnFamily,
+    _Iterator,
+    _Transaction,
+    TransactionDBType,
+    Response,
+    MultiResponse,
+    OptionsResponse,
+    PropertiesResponse,
+    EntityResponse,
+    PerfContext,
+    PerfLevel,
+    Snapshot,
+    BackupEngine,
+    BackupResponse,
+    CatchUpStats,
+    _WriteBatchBase,
+    WriteBatchWithIndex,
+)
 
 import rocksdb, asyncio
 
 logger = getLogger(__name__)
 
+# Set by `RocksDB.perfContext` for the current task, innermost last
+_perf_contexts: ContextVar[Tuple[PerfContext, ...]] = ContextVar(
+    "perf_contexts", default=()
+)
+
 
 class NotSupported(Exception):
     pass
@@ -36,6 +78,21 @@ class RocksDB:
         workers (``int``, optional):
             Number of workers for :py:class:`~concurrent.futures.ThreadPoolExecutor`. Defaults to 1.
 
+        column_families (Dict[``str``, :class:`~rocksdb.ColumnFamilyOptions`], optional):
+            Column families to open (and create if `create_missing_column_families` is set) with their options. Column families that already exist but are not listed are opened with `options`. Defaults to None.
+
+        native_executor (``bool``, optional):
+            If `True` run `get`, `multiGet`, `keyMayExist`, `put`, `merge`, `delete` and `write` on a :class:`~rocksdb.NativeExecutor` with `workers` native threads instead of the :py:class:`~concurrent.futures.ThreadPoolExecutor`. Requires an event loop that supports `add_reader`. Defaults to False.
+
+        transaction_db (:class:`~rocksdb.TransactionDBType`, optional):
+            Open the database as a pessimistic `TransactionDB` or an `OptimisticTransactionDB` to use `transaction`. Not supported with `read_only`. Defaults to `TransactionDBType.none`.
+
+        transaction_db_options (:class:`~rocksdb.TransactionDBOptions`, optional):
+            Lock table options and default lock timeouts of a pessimistic `transaction_db`. Defaults to None.
+
+        transaction_workers (``int``, optional):
+            Number of workers for the :py:class:`~concurrent.futures.ThreadPoolExecutor` running pessimistic transactions. A transaction waiting for a lock holds a worker until it gets the lock or times out, so size it to the number of transactions expected to wait at once. Defaults to 4.
+
     Raises:
         `TypeError`
         `ValueError`
@@ -50,6 +107,11 @@ class RocksDB:
         secondary_path: str = None,
         loop: asyncio.AbstractEventLoop = None,
         workers: int = 1,
+        native_executor: bool = False,
+        column_families: Dict[str, ColumnFamilyOptions] = None,
+        transaction_db: TransactionDBType = TransactionDBType.none,
+        transaction_db_options: TransactionDBOptions = None,
+        transaction_workers: int = 4,
     ) -> None:
 
         if not isinstance(db_path, str):
@@ -62,6 +124,26 @@ class RocksDB:
             raise TypeError("workers must be int")
         elif workers < 1:
             raise ValueError("workers must be greater than 1")
+        elif not isinstance(native_executor, bool):
+            raise TypeError("native_executor must be boolean")
+        elif column_families is not None and not (
+            isinstance(column_families, dict)
+            and all(
+                isinstance(name, str) and isinstance(cf_options, ColumnFamilyOptions)
+                for name, cf_options in column_families.items()
+            )
+        ):
+            raise TypeError("column_families must be dict of str and ColumnFamilyOptions")
+        elif not isinstance(transaction_db, TransactionDBType):
+            raise TypeError(f"Invalid class '{type(transaction_db).__name__}'")
+        elif transaction_db_options is not None and not isinstance(
+            transaction_db_options, TransactionDBOptions
+        ):
+            raise TypeError(f"Invalid class '{type(transaction_db_options).__name__}'")
+        elif not isinstance(transaction_workers, int):
+            raise TypeError("transaction_workers must be int")
+        elif transaction_workers < 1:
+            raise ValueError("transaction_workers must be greater than 0")
 
         if isinstance(loop, asyncio.AbstractEventLoop):
             self.loop = loop
@@ -80,7 +162,16 @@ class RocksDB:
         self.options = options
         self.read_only = read_only
         self.workers = workers
+        self.transaction_db = transaction_db
         self.executer = ThreadPoolExecutor(workers)
+        self.transaction_executer = (
+            ThreadPoolExecutor(transaction_workers, thread_name_prefix="rocksdb-transaction")
+            if transaction_db == TransactionDBType.pessimistic
+            else None
+        )
+        self.native_executor = (
+            NativeExecutor(self.loop, workers) if native_executor else None
+        )
 
         logger.info(rocksdb.getRocksBuildInfo(verbose=True))
 
@@ -97,6 +188,9 @@ class RocksDB:
             self.options,
             self.read_only,
             self.secondary_path,
+            column_families or {},
+            transaction_db,
+            transaction_db_options,
         )
 
         logger.info("Connected to rocksdb")
@@ -114,47 +208,123 @@ class RocksDB:
     def is_running(self) -> bool:
         return self.__rocksdb.is_running
 
-    async def get(self, options: ReadOptions, key: str) -> Response:
-        """Get the value of `key`
+    def __run(self, method: str, *args) -> asyncio.Future:
+        perf_contexts = _perf_contexts.get()
+        if perf_contexts:
+            # Perf contexts are thread local, the request is captured on the worker that runs it by every
+            # enclosing `perfContext` block, the innermost one sets the perf level
+            func = getattr(self.__rocksdb, method)
+            for perf_context in reversed(perf_contexts):
+                func = partial(perf_context.Run, func)
+
+            return self.loop.run_in_executor(self.executer, func, *args)
+        elif self.native_executor is not None:
+            return self.native_executor.run(method, self.__rocksdb, *args)
+
+        return self.loop.run_in_executor(
+            self.executer, getattr(self.__rocksdb, method), *args
+        )
+
+    @contextmanager
+    def perfContext(
+        self, level: PerfLevel = PerfLevel.enable_time_except_for_mutex
+    ) -> Generator[PerfContext, None, None]:
+        """Capture RocksDB perf and IO stats counters of the `get`, `multiGet`, `keyMayExist`, `put`, `merge`, `delete` and `write` requests awaited inside the `with` block by the current task. Blocks may be nested, requests are counted by every block they are in
+
+        Example:
+            .. code-block:: python
+
+                with db.perfContext() as perf:
+                    await db.get(rocksdb.ReadOptions(), "key")
+
+                print(perf.to_dict()["block_cache_hit_count"])
 
         Args:
-            options (:class:`~rocksdb.ReadOptions`):
-                RocksDB read options.
+            level (:class:`~rocksdb.PerfLevel`, optional):
+                What to measure. Defaults to `PerfLevel.enable_time_except_for_mutex`.
 
-            key (``str``):
-                The key.
+        Raises:
+            `TypeError`
+
+        Returns:
+            :class:`~rocksdb.PerfContext`
+        """
+
+        if not isinstance(level, PerfLevel):
+            raise TypeError(f"Invalid class '{type(level).__name__}'")
+
+        perf_context = PerfContext(level)
+        token = _perf_contexts.set(_perf_contexts.get() + (perf_context,))
+        try:
+            yield perf_context
+        finally:
+            _perf_contexts.reset(token)
+
+    @asynccontextmanager
+    async def snapshot(self) -> AsyncGenerator[Snapshot, None]:
+        """Consistent point in time view of the database, released when the `async with` block exits
+
+        Example:
+            .. code-block:: python
+
+                async with db.snapshot() as snapshot:
+                    options = rocksdb.ReadOptions(snapshot=snapshot)
+                    first = await db.get(options, "a")
+                    second = await db.get(options, "b")
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            :class:`~rocksdb.Snapshot`
+        """
+
+        snapshot = await self.loop.run_in_executor(
+            self.executer, Snapshot, self.__rocksdb
+        )
+        try:
+            yield snapshot
+        finally:
+            await self.loop.run_in_executor(self.executer, snapshot.Release)
+
+    async def createColumnFamily(
+        self, options: ColumnFamilyOptions, name: str
+    ) -> ColumnFamily:
+        """Create a column family
+
+        Args:
+            options (:class:`~rocksdb.ColumnFamilyOptions`):
+                RocksDB column family options.
+
+            name (``str``):
+                The column family name.
 
         Raises:
             `TypeError`
-           `RuntimeError`
+            `ValueError`
+            `RuntimeError`
 
         Returns:
-            `Response`
+            :class:`~rocksdb.ColumnFamily`
         """
 
-        if not isinstance(key, str):
-            raise TypeError("key must be str")
-        elif not isinstance(options, ReadOptions):
+        if not isinstance(name, str):
+            raise TypeError("name must be str")
+        elif not isinstance(options, ColumnFamilyOptions):
             raise TypeError(f"Invalid class '{type(options).__name__}'")
 
         future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.Get, options, key
+            self.executer, self.__rocksdb.CreateColumnFamily, options, name
         )
 
         return await future
 
-    async def put(self, options: WriteOptions, key: str, value: str) -> Response:
-        """Set the database entry for `key` to `value`
+    async def dropColumnFamily(self, column_family: ColumnFamily) -> Response:
+        """Drop a column family, its handle can't be used afterwards
 
         Args:
-            options (:class:`~rocksdb.WriteOptions`):
-                RocksDB read options.
-
-            key (``str``):
-                The key.
-
-            value (``str``):
-                The value of the `key`.
+            column_family (:class:`~rocksdb.ColumnFamily`):
+                The column family.
 
         Raises:
             `TypeError`
@@ -164,128 +334,297 @@ class RocksDB:
             `Response`
         """
 
-        if not isinstance(key, str):
-            raise TypeError("key must be str")
-        elif not isinstance(value, str):
-            raise TypeError("value must be str")
-        elif not isinstance(options, WriteOptions):
-            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        if not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
         future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.Put, options, key, value
+            self.executer, self.__rocksdb.DropColumnFamily, column_family
         )
 
         return await future
 
-    async def merge(self, options: WriteOptions, key: str, value: str) -> Response:
-        """Merge the database entry for `key` with `value`
+    def getColumnFamily(self, name: str) -> ColumnFamily:
+        """Get an open column family by name
 
         Args:
-            options (:class:`~rocksdb.WriteOptions`):
+            name (``str``):
+                The column family name.
+
+        Raises:
+            `TypeError`
+            `ValueError`
+            `RuntimeError`
+
+        Returns:
+            :class:`~rocksdb.ColumnFamily`
+        """
+
+        if not isinstance(name, str):
+            raise TypeError("name must be str")
+
+        return self.__rocksdb.GetColumnFamily(name)
+
+    def listColumnFamilies(self) -> List[str]:
+        """Names of the open column families
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            List[``str``]
+        """
+
+        return self.__rocksdb.ListColumnFamilies()
+
+    async def get(
+        self, options: ReadOptions, key: Binary, column_family: ColumnFamily = None
+    ) -> Response:
+        """Get the value of `key`
+
+        Args:
+            options (:class:`~rocksdb.ReadOptions`):
                 RocksDB read options.
 
-            key (``str``):
+            key (``str`` | ``bytes``):
                 The key.
 
-            value (``str``):
-                The value of the `key`.
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
             `TypeError`
-            `RuntimeError`
+           `RuntimeError`
 
         Returns:
-            `Response`
+            `Response`: `value` is a read-only :class:`~rocksdb.Value` buffer pinned in the block cache, use `bytes(value)`, `str(value)` or `memoryview(value)`
         """
 
-        if not isinstance(key, str):
-            raise TypeError("key must be str")
-        elif not isinstance(value, str):
-            raise TypeError("value must be str")
-        elif not isinstance(options, WriteOptions):
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, ReadOptions):
             raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
-        future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.Merge, options, key, value
-        )
+        future = self.__run("Get", options, key, column_family)
 
         return await future
 
-    async def keyMayExist(self, options: ReadOptions, key: str) -> Response:
-        """Check if `key` may exists
+    async def multiGet(
+        self, options: ReadOptions, keys: List[Binary], column_family: ColumnFamily = None
+    ) -> MultiResponse:
+        """Get the values of many `keys` in one batched lookup
+
+        Set `async_io` and `optimize_multiget_for_io` in `options` to let RocksDB read the batch in parallel.
 
         Args:
             options (:class:`~rocksdb.ReadOptions`):
                 RocksDB read options.
 
-            key (``str``):
-                The key.
+            keys (List[``str`` | ``bytes``]):
+                The keys.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
             `TypeError`
             `RuntimeError`
 
         Returns:
-            `Response`
+            `MultiResponse`: `statuses` and `values` in the same order as `keys`
         """
 
-        if not isinstance(key, str):
-            raise TypeError("key must be str")
+        if not isinstance(keys, list):
+            raise TypeError("keys must be list")
+        elif not all(isinstance(key, BINARY_TYPES) for key in keys):
+            raise TypeError("keys must be list of str or bytes-like")
         elif not isinstance(options, ReadOptions):
             raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
-        future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.KeyMayExist, options, key
+        future = self.__run(
+            "MultiGet", options, [as_string(key) for key in keys], column_family
         )
 
         return await future
 
-    async def delete(self, options: WriteOptions, key: str) -> Response:
-        """Remove the database entry (if any) for `key`
+    def iterator(
+        self,
+        options: ReadOptions,
+        lower_bound: Binary = None,
+        upper_bound: Binary = None,
+        chunk_size: int = 1000,
+        reverse: bool = False,
+        column_family: ColumnFamily = None,
+    ) -> Iterator:
+        """Create an iterator over the database
+
+        `options.readahead_size`, `options.async_io` and `options.prefix_same_as_start` are honored by the scan.
 
         Args:
-            options (:class:`~rocksdb.WriteOptions`):
+            options (:class:`~rocksdb.ReadOptions`):
                 RocksDB read options.
 
-            key (``str``):
-                The key.
+            lower_bound (``str`` | ``bytes``, optional):
+                Inclusive lower bound of the scan. Defaults to None.
+
+            upper_bound (``str`` | ``bytes``, optional):
+                Exclusive upper bound of the scan. Defaults to None.
+
+            chunk_size (``int``, optional):
+                Number of entries fetched per executor hop. Defaults to 1000.
+
+            reverse (``bool``, optional):
+                If `True` iterate from the last key to the first. Defaults to False.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
             `TypeError`
+            `ValueError`
             `RuntimeError`
 
         Returns:
-            `Response`
+            :class:`~rocksdb.Iterator`
         """
 
-        if not isinstance(key, str):
-            raise TypeError("key must be str")
-        elif not isinstance(options, WriteOptions):
+        if not isinstance(options, ReadOptions):
             raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif lower_bound is not None and not isinstance(lower_bound, BINARY_TYPES):
+            raise TypeError("lower_bound must be str or bytes-like")
+        elif upper_bound is not None and not isinstance(upper_bound, BINARY_TYPES):
+            raise TypeError("upper_bound must be str or bytes-like")
+        elif not isinstance(chunk_size, int):
+            raise TypeError("chunk_size must be int")
+        elif chunk_size < 1:
+            raise ValueError("chunk_size must be greater than 0")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        return Iterator(
+            self.loop,
+            self.executer,
+            _Iterator(
+                self.__rocksdb,
+                options,
+                None if lower_bound is None else as_string(lower_bound),
+                None if upper_bound is None else as_string(upper_bound),
+                column_family,
+            ),
+            chunk_size,
+            reverse,
+        )
 
-        future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.Del, options, key
+    def transaction(
+        self, options: WriteOptions, transaction_options: TransactionOptions = None
+    ) -> Transaction:
+        """Begin a transaction, the database must be opened with `transaction_db`
+
+        Example:
+            .. code-block:: python
+
+                async with db.transaction(rocksdb.WriteOptions()) as txn:
+                    response = await txn.getForUpdate(rocksdb.ReadOptions(), "counter")
+                    await txn.put("counter", b"1" if response.status.is_not_found else bytes(response.value) + b"1")
+                    await txn.commit()
+
+        Pessimistic transactions run on `transaction_workers`, so their lock waits never hold up `workers`.
+
+        Args:
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB write options, used on commit.
+
+            transaction_options (:class:`~rocksdb.TransactionOptions`, optional):
+                Lock timeout, deadlock detection and snapshot of the transaction. Defaults to None.
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            :class:`~rocksdb.Transaction`
+        """
+
+        if not isinstance(options, WriteOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif transaction_options is None:
+            transaction_options = TransactionOptions()
+        elif not isinstance(transaction_options, TransactionOptions):
+            raise TypeError(f"Invalid class '{type(transaction_options).__name__}'")
+
+        return Transaction(
+            self.loop,
+            self.transaction_executer or self.executer,
+            _Transaction(self.__rocksdb, options, transaction_options),
         )
 
-        return await future
+    async def put(
+        self,
+        options: WriteOptions,
+        key: Binary,
+        value: Binary,
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Set the database entry for `key` to `value`
 
-    async def getOptions(self) -> Response:
-        """Get DB Options that we use
+        Args:
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB read options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            value (``str`` | ``bytes``):
+                The value of the `key`.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
 
         Returns:
             `Response`
         """
 
-        future = self.loop.run_in_executor(self.executer, self.__rocksdb.GetOptions)
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(value, BINARY_TYPES):
+            raise TypeError("value must be str or bytes-like")
+        elif not isinstance(options, WriteOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.__run("Put", options, key, value, column_family)
 
         return await future
 
-    async def setOptions(self, options: Dict[str, str]) -> Response:
-        """Dynamically change options a running DB
+    async def merge(
+        self,
+        options: WriteOptions,
+        key: Binary,
+        value: Binary,
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Merge the database entry for `key` with `value`
 
         Args:
-            options (Dict[`str`, `str`]):
-                The Dictionary with option name and thier value.
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB read options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            value (``str`` | ``bytes``):
+                The value of the `key`.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
             `TypeError`
@@ -295,68 +634,139 @@ class RocksDB:
             `Response`
         """
 
-        if not isinstance(options, dict):
-            raise TypeError("options must be dict")
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(value, BINARY_TYPES):
+            raise TypeError("value must be str or bytes-like")
+        elif not isinstance(options, WriteOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
-        future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.SetOptions, options
-        )
+        future = self.__run("Merge", options, key, value, column_family)
 
         return await future
 
-    async def setDBOptions(self, options: Dict[str, str]) -> Response:
-        """Just like `setOptions` but for `DBoptions`
+    async def putEntity(
+        self,
+        options: WriteOptions,
+        key: Binary,
+        columns: Dict[Binary, Binary],
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Set the database entry for `key` to a wide-column entity
+
+        Example:
+            .. code-block:: python
+
+                await db.putEntity(rocksdb.WriteOptions(), "user:1", {"": summary, "name": "aymen", "avatar": image})
+                response = await db.getEntity(rocksdb.ReadOptions(), "user:1", names=["name"])
 
         Args:
-            options (Dict[`str`, `str`]):
-                The Dictionary with option name and thier value.
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB write options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            columns (Dict[``str`` | ``bytes``, ``str`` | ``bytes``]):
+                Column names and values. The default column `""` is what `get` returns for `key`.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
             `TypeError`
             `RuntimeError`
 
         Returns:
-            `Response`
+            `Response`: `status.is_not_supported` if RocksDB is older than 8.0
         """
-        if not isinstance(options, dict):
-            raise TypeError("options must be dict")
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, WriteOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif not isinstance(columns, dict) or not all(
+            isinstance(name, BINARY_TYPES) and isinstance(value, BINARY_TYPES)
+            for name, value in columns.items()
+        ):
+            raise TypeError("columns must be dict of str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
         future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.SetDBOptions, options
+            self.executer,
+            self.__rocksdb.PutEntity,
+            options,
+            key,
+            {as_string(name): as_string(value) for name, value in columns.items()},
+            column_family,
         )
 
         return await future
 
-    async def getProperty(self, property: str) -> Response:
-        """Get property state
+    async def getEntity(
+        self,
+        options: ReadOptions,
+        key: Binary,
+        names: List[Binary] = None,
+        column_family: ColumnFamily = None,
+    ) -> EntityResponse:
+        """Get the columns of the wide-column entity of `key`
 
         Args:
-            property (``str``):
-                The property.
+            options (:class:`~rocksdb.ReadOptions`):
+                RocksDB read options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            names (List[``str`` | ``bytes``], optional):
+                Only return these columns, the others are not copied. Defaults to None (all columns).
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
             `TypeError`
             `RuntimeError`
 
         Returns:
-            `Response`
+            :class:`~rocksdb.EntityResponse`: `columns` maps ``bytes`` names to ``bytes`` values, a plain value is returned as the default column `b""`
         """
 
-        if not isinstance(property, str):
-            raise TypeError("key must be str")
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, ReadOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif names is not None and not (
+            isinstance(names, list) and all(isinstance(name, BINARY_TYPES) for name in names)
+        ):
+            raise TypeError("names must be list of str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
         future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.GetProperty, property
+            self.executer,
+            self.__rocksdb.GetEntity,
+            options,
+            key,
+            None if names is None else [as_string(name) for name in names],
+            column_family,
         )
 
         return await future
 
-    async def flush(self, options: FlushOptions) -> Response:
-        """Flush all mem-table data
+    async def write(self, options: WriteOptions, batch: _WriteBatchBase) -> Response:
+        """Apply all the updates in `batch` atomically
 
         Args:
-            options (:class:`~rocksdb.FlushOptions`):
-                RocksDB Flush options.
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB write options.
+
+            batch (:class:`~rocksdb.WriteBatch` | :class:`~rocksdb.WriteBatchWithIndex`):
+                The batch of updates.
 
         Raises:
             `TypeError`
@@ -366,46 +776,781 @@ class RocksDB:
             `Response`
         """
 
-        if not isinstance(options, FlushOptions):
+        if not isinstance(batch, _WriteBatchBase):
+            raise TypeError(f"Invalid class '{type(batch).__name__}'")
+        elif not isinstance(options, WriteOptions):
             raise TypeError(f"Invalid class '{type(options).__name__}'")
 
-        future = self.loop.run_in_executor(self.executer, self.__rocksdb.Flush, options)
+        future = self.__run("Write", options, batch)
 
         return await future
 
-    async def tryCatchUpWithPrimary(self) -> Response:
-        """Make the secondary instance catch up with the primary by tailing and replaying the MANIFEST and WAL of the primary
+    async def getFromBatchAndDB(
+        self,
+        options: ReadOptions,
+        batch: WriteBatchWithIndex,
+        key: Binary,
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Get the value of `key` as seen after applying `batch` to the database
+
+        Args:
+            options (:class:`~rocksdb.ReadOptions`):
+                RocksDB read options.
+
+            batch (:class:`~rocksdb.WriteBatchWithIndex`):
+                The pending batch of updates.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
-            :class:`~rocksdb.NotSupported`
+            `TypeError`
             `RuntimeError`
 
         Returns:
             `Response`
         """
 
-        if not self.read_only:
-            raise NotSupported(
-                "tryCatchUpWithPrimary is not supported for non-read_only instance"
-            )
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(batch, WriteBatchWithIndex):
+            raise TypeError(f"Invalid class '{type(batch).__name__}'")
+        elif not isinstance(options, ReadOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
 
         future = self.loop.run_in_executor(
-            self.executer, self.__rocksdb.TryCatchUpWithPrimary
+            self.executer,
+            self.__rocksdb.GetFromBatchAndDB,
+            options,
+            batch,
+            key,
+            column_family,
         )
 
         return await future
 
-    async def close(self) -> Response:
-        """Close the DB by releasing resources, closing files etc
+    async def keyMayExist(
+        self, options: ReadOptions, key: Binary, column_family: ColumnFamily = None
+    ) -> Response:
+        """Check if `key` may exists
+
+        Args:
+            options (:class:`~rocksdb.ReadOptions`):
+                RocksDB read options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
 
         Raises:
+            `TypeError`
             `RuntimeError`
 
         Returns:
             `Response`
         """
-        future = asyncio.Future()
 
-        future = self.loop.run_in_executor(self.executer, self.__rocksdb.Close)
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, ReadOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.__run("KeyMayExist", options, key, column_family)
 
         return await future
+
+    async def delete(
+        self, options: WriteOptions, key: Binary, column_family: ColumnFamily = None
+    ) -> Response:
+        """Remove the database entry (if any) for `key`
+
+        Args:
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB read options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, WriteOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.__run("Del", options, key, column_family)
+
+        return await future
+
+    async def deleteRange(
+        self,
+        options: WriteOptions,
+        begin_key: Binary,
+        end_key: Binary,
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Delete every key in the range [`begin_key`, `end_key`) with a single range tombstone
+
+        Args:
+            options (:class:`~rocksdb.WriteOptions`):
+                RocksDB write options.
+
+            begin_key (``str``, ``bytes``, ``bytearray``, ``memoryview``):
+                First key of the range.
+
+            end_key (``str``, ``bytes``, ``bytearray``, ``memoryview``):
+                Key after the last key of the range.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(options, WriteOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif not isinstance(begin_key, BINARY_TYPES):
+            raise TypeError("begin_key must be str or bytes-like")
+        elif not isinstance(end_key, BINARY_TYPES):
+            raise TypeError("end_key must be str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.DeleteRange,
+            options,
+            begin_key,
+            end_key,
+            column_family,
+        )
+
+        return await future
+
+    async def getOptions(self, column_family: ColumnFamily = None) -> OptionsResponse:
+        """Get DB Options that we use
+
+        Args:
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Returns:
+            `OptionsResponse`
+        """
+
+        if column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.GetOptions, column_family
+        )
+
+        return await future
+
+    async def setOptions(
+        self, options: Dict[str, str], column_family: ColumnFamily = None
+    ) -> Response:
+        """Dynamically change options a running DB
+
+        Args:
+            options (Dict[`str`, `str`]):
+                The Dictionary with option name and thier value.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(options, dict):
+            raise TypeError("options must be dict")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.SetOptions, options, column_family
+        )
+
+        return await future
+
+    async def setDBOptions(self, options: Dict[str, str]) -> Response:
+        """Just like `setOptions` but for `DBoptions`
+
+        Args:
+            options (Dict[`str`, `str`]):
+                The Dictionary with option name and thier value.
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+        if not isinstance(options, dict):
+            raise TypeError("options must be dict")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.SetDBOptions, options
+        )
+
+        return await future
+
+    async def getProperty(
+        self, property: str, column_family: ColumnFamily = None
+    ) -> Response:
+        """Get property state
+
+        Args:
+            property (``str``):
+                The property.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(property, str):
+            raise TypeError("key must be str")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.GetProperty, property, column_family
+        )
+
+        return await future
+
+    async def getMapProperty(
+        self, property: str, column_family: ColumnFamily = None
+    ) -> PropertiesResponse:
+        """Get a map property (e.g. `rocksdb.cfstats`) as a dict
+
+        Args:
+            property (``str``):
+                The property.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `PropertiesResponse`
+        """
+
+        if not isinstance(property, str):
+            raise TypeError("key must be str")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.GetMapProperty, property, column_family
+        )
+
+        return await future
+
+    async def getIntProperties(
+        self, properties: List[str], column_family: ColumnFamily = None
+    ) -> Dict[str, int]:
+        """Get many integer properties (e.g. `rocksdb.estimate-num-keys`) in one call
+
+        Args:
+            properties (``List[str]``):
+                The properties.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            Dict[``str``, ``int``]: Properties that were found
+        """
+
+        if not isinstance(properties, list):
+            raise TypeError(f"Invalid class '{type(properties).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.GetIntProperties, properties, column_family
+        )
+
+        return await future
+
+    async def flush(
+        self, options: FlushOptions, column_family: ColumnFamily = None
+    ) -> Response:
+        """Flush all mem-table data
+
+        Args:
+            options (:class:`~rocksdb.FlushOptions`):
+                RocksDB Flush options.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(options, FlushOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.Flush, options, column_family
+        )
+
+        return await future
+
+    async def compactRange(
+        self,
+        options: CompactRangeOptions,
+        begin: Binary = None,
+        end: Binary = None,
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Compact the keys in the range [`begin`, `end`], runs until the compaction is done
+
+        Args:
+            options (:class:`~rocksdb.CompactRangeOptions`):
+                RocksDB CompactRange options.
+
+            begin (``str``, ``bytes``, optional):
+                First key of the range. Defaults to None (from the first key).
+
+            end (``str``, ``bytes``, optional):
+                Last key of the range. Defaults to None (to the last key).
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(options, CompactRangeOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif begin is not None and not isinstance(begin, BINARY_TYPES):
+            raise TypeError("begin must be str or bytes-like")
+        elif end is not None and not isinstance(end, BINARY_TYPES):
+            raise TypeError("end must be str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.CompactRange,
+            options,
+            None if begin is None else as_string(begin),
+            None if end is None else as_string(end),
+            column_family,
+        )
+
+        return await future
+
+    async def compactFiles(
+        self,
+        options: CompactionOptions,
+        files: List[str],
+        output_level: int,
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Compact the given SST files into `output_level`
+
+        Args:
+            options (:class:`~rocksdb.CompactionOptions`):
+                RocksDB compaction options.
+
+            files (``List[str]``):
+                Names of the SST files to compact.
+
+            output_level (``int``):
+                Level the output files are written to.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(options, CompactionOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif not isinstance(files, list):
+            raise TypeError(f"Invalid class '{type(files).__name__}'")
+        elif not isinstance(output_level, int):
+            raise TypeError("output_level must be int")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.CompactFiles,
+            options,
+            files,
+            output_level,
+            column_family,
+        )
+
+        return await future
+
+    async def suggestCompactRange(
+        self, begin: Binary = None, end: Binary = None, column_family: ColumnFamily = None
+    ) -> Response:
+        """Mark the files overlapping the range [`begin`, `end`] for compaction, without waiting for it
+
+        Args:
+            begin (``str``, ``bytes``, optional):
+                First key of the range. Defaults to None (from the first key).
+
+            end (``str``, ``bytes``, optional):
+                Last key of the range. Defaults to None (to the last key).
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if begin is not None and not isinstance(begin, BINARY_TYPES):
+            raise TypeError("begin must be str or bytes-like")
+        elif end is not None and not isinstance(end, BINARY_TYPES):
+            raise TypeError("end must be str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.SuggestCompactRange,
+            None if begin is None else as_string(begin),
+            None if end is None else as_string(end),
+            column_family,
+        )
+
+        return await future
+
+    async def enableAutoCompaction(
+        self, column_families: List[ColumnFamily] = None
+    ) -> Response:
+        """Resume automatic compactions after opening with `disable_auto_compactions`
+
+        Args:
+            column_families (List[:class:`~rocksdb.ColumnFamily`], optional):
+                Column families to enable. Defaults to None (every open column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if column_families is not None and not (
+            isinstance(column_families, list)
+            and all(isinstance(cf, ColumnFamily) for cf in column_families)
+        ):
+            raise TypeError("column_families must be list of ColumnFamily")
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.EnableAutoCompaction, column_families or []
+        )
+
+        return await future
+
+    async def createCheckpoint(
+        self, checkpoint_dir: str, log_size_for_flush: int = 0
+    ) -> Response:
+        """Create an openable copy of the database in `checkpoint_dir` by hard-linking its files, without pausing writes
+
+        Args:
+            checkpoint_dir (``str``):
+                Directory of the checkpoint, must not exist.
+
+            log_size_for_flush (``int``, optional):
+                Flush the memtables first unless the WAL is smaller than this many bytes, in which case the WAL is copied instead. Defaults to 0 (always flush).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(checkpoint_dir, str):
+            raise TypeError("checkpoint_dir must be str")
+        elif not isinstance(log_size_for_flush, int):
+            raise TypeError("log_size_for_flush must be int")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.CreateCheckpoint,
+            checkpoint_dir,
+            log_size_for_flush,
+        )
+
+        return await future
+
+    async def createBackup(
+        self,
+        backup_engine: BackupEngine,
+        flush_before_backup: bool = False,
+        progress: Callable[[int], None] = None,
+    ) -> BackupResponse:
+        """Create an incremental backup of the database with `backup_engine`
+
+        Args:
+            backup_engine (:class:`~rocksdb.BackupEngine`):
+                Backup engine opened with :class:`~rocksdb.BackupEngineOptions`.
+
+            flush_before_backup (``bool``, optional):
+                Flush the memtables first instead of copying the WAL. Defaults to False.
+
+            progress (``Callable[[int], None]``, optional):
+                Called from the backup thread every `callback_trigger_interval_size` bytes with an estimate of the bytes copied so far, a lower bound that misses up to `callback_trigger_interval_size` per copied file. Use :py:meth:`~asyncio.loop.call_soon_threadsafe` to get back to the event loop. Defaults to None.
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `BackupResponse`
+        """
+
+        if not isinstance(backup_engine, BackupEngine):
+            raise TypeError(f"Invalid class '{type(backup_engine).__name__}'")
+        elif not isinstance(flush_before_backup, bool):
+            raise TypeError("flush_before_backup must be boolean")
+        elif progress is not None and not callable(progress):
+            raise TypeError("progress must be callable")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            backup_engine.CreateNewBackup,
+            self.__rocksdb,
+            flush_before_backup,
+            progress,
+        )
+
+        return await future
+
+    async def ingestExternalFile(
+        self,
+        options: IngestExternalFileOptions,
+        files: List[str],
+        column_family: ColumnFamily = None,
+    ) -> Response:
+        """Load SST files built with :class:`~rocksdb.SstFileWriter` into the database
+
+        Files that don't overlap each other are placed in the lowest level their key ranges allow, files that overlap each other all land in level 0. `options.ingest_behind` requires files that don't overlap each other (like the ones written by `SstFileWriter.Generate`) and a database opened with `allow_ingest_behind`.
+
+        Args:
+            options (:class:`~rocksdb.IngestExternalFileOptions`):
+                RocksDB IngestExternalFile options.
+
+            files (``List[str]``):
+                Paths of the SST files to ingest.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(options, IngestExternalFileOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif not isinstance(files, list):
+            raise TypeError(f"Invalid class '{type(files).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.IngestExternalFile,
+            files,
+            options,
+            column_family,
+        )
+
+        return await future
+
+    async def tryCatchUpWithPrimary(self) -> Response:
+        """Make the secondary instance catch up with the primary by tailing and replaying the MANIFEST and WAL of the primary
+
+        Raises:
+            :class:`~rocksdb.NotSupported`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not self.read_only:
+            raise NotSupported(
+                "tryCatchUpWithPrimary is not supported for non-read_only instance"
+            )
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.TryCatchUpWithPrimary
+        )
+
+        return await future
+
+    async def startAutoCatchUp(
+        self, interval: float = 1.0, watch_files: bool = False, min_interval: float = 0.1
+    ) -> Response:
+        """Make the secondary instance catch up with the primary on a native background thread
+
+        Args:
+            interval (``float``, optional):
+                Seconds between two catch-ups. Defaults to 1.0.
+
+            watch_files (``bool``, optional):
+                Also catch up when the primary writes to its MANIFEST or WAL (Linux only, uses inotify). Defaults to False.
+
+            min_interval (``float``, optional):
+                Minimum seconds between two catch-ups triggered by `watch_files`, the writes in between are replayed by a single catch-up. Defaults to 0.1.
+
+        Raises:
+            :class:`~rocksdb.NotSupported`
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not self.read_only:
+            raise NotSupported(
+                "startAutoCatchUp is not supported for non-read_only instance"
+            )
+        elif not isinstance(interval, (int, float)):
+            raise TypeError("interval must be int or float")
+        elif not isinstance(watch_files, bool):
+            raise TypeError("watch_files must be boolean")
+        elif not isinstance(min_interval, (int, float)):
+            raise TypeError("min_interval must be int or float")
+
+        future = self.loop.run_in_executor(
+            self.executer,
+            self.__rocksdb.StartAutoCatchUp,
+            max(1, int(interval * 1000)),
+            watch_files,
+            max(0, int(min_interval * 1000)),
+        )
+
+        return await future
+
+    async def stopAutoCatchUp(self) -> Response:
+        """Stop the background catch-up thread started by `startAutoCatchUp`
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        future = self.loop.run_in_executor(
+            self.executer, self.__rocksdb.StopAutoCatchUp
+        )
+
+        return await future
+
+    def getCatchUpStats(self) -> Union[CatchUpStats, None]:
+        """Lag metrics of the background catch-up thread: `sequence_number`, `staleness` (milliseconds since the last successful catch-up), `last_duration` (microseconds), `last_sequence_delta`, `catch_ups` and `failures`
+
+        Returns:
+            :class:`~rocksdb.CatchUpStats`, `None` if the thread is not running
+        """
+
+        return self.__rocksdb.GetCatchUpStats()
+
+    async def close(self) -> Response:
+        """Close the DB by releasing resources, closing files etc
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+        future = asyncio.Future()
+
+        future = self.loop.run_in_executor(self.executer, self.__rocksdb.Close)
+
+        try:
+            return await future
+        finally:
+            if self.native_executor is not None:
+                self.native_executor.shutdown()
+            if self.transaction_executer is not None:
+                self.transaction_executer.shutdown(wait=False)
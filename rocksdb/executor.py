@@ -0,0 +1,63 @@
+from itertools import count
+from .rocksdb_ext import _Executor
+
+import asyncio
+
+
+class NativeExecutor:
+    """Runs requests on native worker threads and completes their futures in batches
+
+    Unlike :py:class:`~concurrent.futures.ThreadPoolExecutor` there is no `call_soon_threadsafe` per request, the event loop watches a single file descriptor and completes every finished request on one wakeup.
+
+    Args:
+        loop (:py:class:`~asyncio.AbstractEventLoop`):
+            Event loop. It must support `add_reader` (any loop on Linux and macOS).
+
+        workers (``int``):
+            Number of native worker threads.
+    """
+
+    def __init__(self, loop: asyncio.AbstractEventLoop, workers: int) -> None:
+        self.loop = loop
+        self.__executor = _Executor(workers)
+        self.__futures = {}
+        self.__ids = count()
+
+        self.loop.add_reader(self.__executor.fd, self.__drain)
+
+    def run(self, method: str, *args) -> asyncio.Future:
+        """Submit `method` of the native executor with `args`
+
+        Returns:
+            :py:class:`~asyncio.Future`
+        """
+
+        request_id = next(self.__ids)
+        future = self.loop.create_future()
+        self.__futures[request_id] = future
+
+        try:
+            getattr(self.__executor, method)(request_id, *args)
+        except Exception:
+            del self.__futures[request_id]
+            raise
+
+        return future
+
+    def shutdown(self) -> None:
+        """Wait for pending requests and stop the worker threads"""
+
+        self.__executor.Shutdown()
+        self.__drain()
+        self.loop.remove_reader(self.__executor.fd)
+
+    def __drain(self) -> None:
+        for request_id, result, error in self.__executor.Drain():
+            future = self.__futures.pop(request_id)
+
+            if future.cancelled():
+                continue
+            elif error is None:
+                future.set_result(result)
+            else:
+                future.set_exception(RuntimeError(error))
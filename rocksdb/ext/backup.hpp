@@ -0,0 +1,138 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+#include <rocksdb/utilities/backup_engine.h>
+
+#include <atomic>
+
+class BackupResponse {
+   public:
+    rocksdb::Status status;
+    uint32_t backup_id;
+
+    BackupResponse(rocksdb::Status s, uint32_t backup_id = 0) : status(std::move(s)), backup_id(backup_id) {}
+};
+
+// Incremental backups aka rocksdb::BackupEngine. Files already present in `backup_dir` are shared between
+// backups, so a new backup only copies what changed since the previous one
+class BackupEngine {
+   public:
+    BackupEngine(rocksdb::BackupEngineOptions &options) : trigger_size(options.callback_trigger_interval_size) {
+        rocksdb::BackupEngine *engine;
+        status s = rocksdb::BackupEngine::Open(rocksdb::Env::Default(), options, &engine);
+        if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+
+        this->engine.reset(engine);
+    }
+
+    BackupEngine(const BackupEngine &) = delete;
+    BackupEngine &operator=(const BackupEngine &) = delete;
+
+    // `progress` is called with an estimate of the bytes copied so far every `callback_trigger_interval_size` bytes.
+    // RocksDB does not report the bytes behind each call and restarts the count for every file, so the estimate
+    // (`callback_trigger_interval_size` per call) is a lower bound missing up to that much per copied file
+    BackupResponse CreateNewBackup(RocksDB &db, bool flush_before_backup = false,
+                                   const std::optional<py::function> &progress = std::nullopt) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+        std::shared_lock<std::shared_mutex> db_lock(db.mutex);
+        db.CHECK_DB();
+
+        this->bytes_copied_estimate = 0;
+
+        rocksdb::CreateBackupOptions options;
+        options.flush_before_backup = flush_before_backup;
+        options.progress_callback = [this, &progress]() {
+            uint64_t bytes_copied_estimate = this->bytes_copied_estimate += this->trigger_size;
+            if (progress.has_value()) {
+                py::gil_scoped_acquire gil;
+                try {
+                    (*progress)(bytes_copied_estimate);
+                } catch (py::error_already_set &e) {
+                    e.discard_as_unraisable("BackupEngine progress callback");
+                }
+            }
+        };
+
+        uint32_t backup_id = 0;
+        status s = this->engine->CreateNewBackup(options, db.db, &backup_id);
+
+        return BackupResponse(s, backup_id);
+    }
+
+    std::vector<rocksdb::BackupInfo> GetBackupInfo() {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+
+        std::vector<rocksdb::BackupInfo> infos;
+        this->engine->GetBackupInfo(&infos);
+        return infos;
+    }
+
+    // Keeps the latest `num_backups_to_keep` backups
+    Response PurgeOldBackups(uint32_t num_backups_to_keep) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+
+        return Response(this->engine->PurgeOldBackups(num_backups_to_keep));
+    }
+
+    Response DeleteBackup(uint32_t backup_id) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+
+        return Response(this->engine->DeleteBackup(backup_id));
+    }
+
+    Response VerifyBackup(uint32_t backup_id, bool verify_with_checksum = false) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+
+        return Response(this->engine->VerifyBackup(backup_id, verify_with_checksum));
+    }
+
+    // The database at `db_dir` must be closed while it is restored
+    Response RestoreDBFromBackup(uint32_t backup_id, const std::string &db_dir, const std::string &wal_dir,
+                                 bool keep_log_files = false) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+
+        return Response(
+            this->engine->RestoreDBFromBackup(rocksdb::RestoreOptions(keep_log_files), backup_id, db_dir, wal_dir));
+    }
+
+    Response RestoreDBFromLatestBackup(const std::string &db_dir, const std::string &wal_dir,
+                                       bool keep_log_files = false) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_ENGINE();
+
+        return Response(
+            this->engine->RestoreDBFromLatestBackup(rocksdb::RestoreOptions(keep_log_files), db_dir, wal_dir));
+    }
+
+    // Lower bound of the bytes copied by the running (or last) backup, see CreateNewBackup
+    uint64_t BytesCopiedEstimate() {
+        return this->bytes_copied_estimate;
+    }
+
+    void Close() {
+        // Wait for running backups and restores
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+        this->engine.reset();
+    }
+
+   private:
+    std::shared_mutex mutex;
+    std::unique_ptr<rocksdb::BackupEngine> engine;
+    std::atomic<uint64_t> bytes_copied_estimate = 0;
+    uint64_t trigger_size;
+
+    void CHECK_ENGINE() {
+        if (!this->engine) {
+            throw std::runtime_error("Cannot invoke request backup engine closed");
+        }
+    }
+};
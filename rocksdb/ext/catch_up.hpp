@@ -0,0 +1,206 @@
+#pragma once
+
+#include <rocksdb/status.h>
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#endif
+
+class CatchUpStats {
+   public:
+    uint64_t catch_ups = 0;
+    uint64_t failures = 0;
+    rocksdb::Status last_status;
+    // Duration of the last catch-up in microseconds
+    uint64_t last_duration = 0;
+    // Sequence numbers replayed by the last successful catch-up
+    uint64_t last_sequence_delta = 0;
+    uint64_t sequence_number = 0;
+    // When the last successful catch-up finished, the secondary is at most this far behind the primary
+    std::chrono::system_clock::time_point last_catch_up;
+
+    // Milliseconds since the last successful catch-up
+    uint64_t Staleness() const {
+        auto elapsed = std::chrono::system_clock::now() - this->last_catch_up;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    }
+};
+
+// Calls `catch_up` on a native thread every `interval`, and on Linux also when files in `watch_path` (the primary
+// MANIFEST and WAL) change, but no sooner than `min_interval` after the previous catch-up: the primary appends to
+// its WAL on every write, a catch-up per append would keep the thread busy. The thread stops when `catch_up`
+// throws, e.g. once the database is closed
+class CatchUpScheduler {
+   public:
+    CatchUpScheduler(std::function<rocksdb::Status()> catch_up, std::function<uint64_t()> sequence_number,
+                     const std::string &watch_path, std::chrono::milliseconds interval, bool watch_files,
+                     std::chrono::milliseconds min_interval)
+        : catch_up(std::move(catch_up)),
+          sequence_number(std::move(sequence_number)),
+          interval(interval),
+          min_interval(std::min(min_interval, interval)) {
+        this->stats.sequence_number = this->sequence_number();
+        this->stats.last_catch_up = std::chrono::system_clock::now();
+        this->last_run = std::chrono::steady_clock::now();
+
+#ifdef __linux__
+        if (watch_files) {
+            this->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            this->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (this->inotify_fd < 0 || this->wake_fd < 0 ||
+                inotify_add_watch(this->inotify_fd, watch_path.c_str(), IN_MODIFY | IN_CREATE | IN_MOVED_TO) < 0) {
+                this->CloseFileDescriptors();
+                throw std::runtime_error("Failed to watch '" + watch_path + "'");
+            }
+        }
+#endif
+
+        this->thread = std::thread([this] { this->Work(); });
+    }
+
+    CatchUpScheduler(const CatchUpScheduler &) = delete;
+    CatchUpScheduler &operator=(const CatchUpScheduler &) = delete;
+
+    ~CatchUpScheduler() {
+        this->Stop();
+        this->CloseFileDescriptors();
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> guard(this->mutex);
+            this->stopped = true;
+        }
+
+        this->cv.notify_all();
+#ifdef __linux__
+        if (this->wake_fd >= 0) {
+            uint64_t one = 1;
+            while (write(this->wake_fd, &one, sizeof(one)) < 0 && errno == EINTR) {
+            }
+        }
+#endif
+
+        if (this->thread.joinable()) {
+            this->thread.join();
+        }
+    }
+
+    CatchUpStats Stats() {
+        std::lock_guard<std::mutex> guard(this->mutex);
+        return this->stats;
+    }
+
+   private:
+    std::function<rocksdb::Status()> catch_up;
+    std::function<uint64_t()> sequence_number;
+    std::chrono::milliseconds interval;
+    std::chrono::milliseconds min_interval;
+    // When the previous catch-up finished, both intervals count from it
+    std::chrono::steady_clock::time_point last_run;
+    int inotify_fd = -1;
+    int wake_fd = -1;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopped = false;
+    CatchUpStats stats;
+
+    void Work() {
+        while (this->Wait()) {
+            auto start = std::chrono::steady_clock::now();
+
+            rocksdb::Status s;
+            uint64_t sequence_number;
+            try {
+                s = this->catch_up();
+                sequence_number = this->sequence_number();
+            } catch (const std::exception &) {
+                return;
+            }
+
+            this->last_run = std::chrono::steady_clock::now();
+            auto duration = this->last_run - start;
+
+            std::lock_guard<std::mutex> guard(this->mutex);
+            this->stats.catch_ups++;
+            this->stats.last_status = s;
+            this->stats.last_duration = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+            if (s.ok()) {
+                this->stats.last_sequence_delta = sequence_number - this->stats.sequence_number;
+                this->stats.sequence_number = sequence_number;
+                this->stats.last_catch_up = std::chrono::system_clock::now();
+            } else {
+                this->stats.failures++;
+            }
+        }
+    }
+
+    // Waits for the interval, or for a file change and the minimum interval, returns false once stopped
+    bool Wait() {
+#ifdef __linux__
+        if (this->inotify_fd >= 0) {
+            auto deadline = this->last_run + this->interval;
+            bool changed = false;
+
+            while (true) {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    break;
+                }
+
+                // Events arriving until the deadline are coalesced into the next catch-up
+                short events = changed ? 0 : POLLIN;
+                pollfd fds[2] = {{this->inotify_fd, events, 0}, {this->wake_fd, POLLIN, 0}};
+                auto timeout = std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+                poll(fds, 2, static_cast<int>(timeout.count()));
+
+                char buffer[4096];
+                while (read(this->inotify_fd, buffer, sizeof(buffer)) > 0) {
+                    if (!changed) {
+                        changed = true;
+                        deadline = std::min(deadline, this->last_run + this->min_interval);
+                    }
+                }
+
+                std::lock_guard<std::mutex> guard(this->mutex);
+                if (this->stopped) {
+                    return false;
+                }
+            }
+
+            std::lock_guard<std::mutex> guard(this->mutex);
+            return !this->stopped;
+        }
+#endif
+
+        std::unique_lock<std::mutex> lock(this->mutex);
+        return !this->cv.wait_for(lock, this->interval, [this] { return this->stopped; });
+    }
+
+    void CloseFileDescriptors() {
+        if (this->inotify_fd >= 0) {
+            close(this->inotify_fd);
+            this->inotify_fd = -1;
+        }
+        if (this->wake_fd >= 0) {
+            close(this->wake_fd);
+            this->wake_fd = -1;
+        }
+    }
+};
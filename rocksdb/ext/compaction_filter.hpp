@@ -0,0 +1,74 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+#include <rocksdb/compaction_filter.h>
+
+#include <set>
+
+// Drops every key starting with one of `prefixes` during compaction, without a python callback per key.
+// Prefixes can be added and removed while the database is open, dropped keys disappear as their files
+// get compacted (run RocksDB::CompactRange over the prefix to reclaim the space right away)
+class PrefixDropFilterFactory : public rocksdb::CompactionFilterFactory {
+   public:
+    PrefixDropFilterFactory(std::vector<std::string> prefixes = {}) : prefixes(prefixes.begin(), prefixes.end()) {}
+
+    void Add(const std::string &prefix) {
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+        this->prefixes.insert(prefix);
+    }
+
+    bool Remove(const std::string &prefix) {
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+        return this->prefixes.erase(prefix) > 0;
+    }
+
+    std::vector<std::string> Prefixes() {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        return std::vector<std::string>(this->prefixes.begin(), this->prefixes.end());
+    }
+
+    std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(
+        const rocksdb::CompactionFilter::Context &) override {
+        return std::make_unique<PrefixFilter>(this->Prefixes());
+    }
+
+    const char *Name() const override {
+        return "PrefixDropFilterFactory";
+    }
+
+   private:
+    std::shared_mutex mutex;
+    std::set<std::string> prefixes;
+
+    // One filter per compaction, it works on a copy of the prefixes taken when the compaction started
+    class PrefixFilter : public rocksdb::CompactionFilter {
+       public:
+        PrefixFilter(std::vector<std::string> prefixes) : prefixes(std::move(prefixes)) {}
+
+        bool Filter(int, const rocksdb::Slice &key, const rocksdb::Slice &, std::string *, bool *) const override {
+            return this->Matches(key);
+        }
+
+        bool FilterMergeOperand(int, const rocksdb::Slice &key, const rocksdb::Slice &) const override {
+            return this->Matches(key);
+        }
+
+        const char *Name() const override {
+            return "PrefixDropFilter";
+        }
+
+       private:
+        std::vector<std::string> prefixes;
+
+        bool Matches(const rocksdb::Slice &key) const {
+            for (auto &prefix : this->prefixes) {
+                if (key.starts_with(prefix)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    };
+};
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+// Runs requests on native worker threads and hands the results back to the event loop in batches.
+// The file descriptor is signalled only when the completion queue goes from empty to non-empty,
+// so many completions cost a single loop wakeup
+class Executor {
+   public:
+    // Converts a finished request to python, always called with the GIL held
+    using Result = std::function<py::object()>;
+
+    Executor(size_t workers) {
+        if (workers == 0) {
+            throw std::invalid_argument("workers must be greater than 0");
+        }
+
+#ifdef __linux__
+        this->read_fd = this->write_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (this->read_fd < 0) {
+            throw std::runtime_error("Failed to create eventfd");
+        }
+#else
+        int fds[2];
+        if (pipe(fds) != 0) {
+            throw std::runtime_error("Failed to create pipe");
+        }
+        for (int fd : fds) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        this->read_fd = fds[0];
+        this->write_fd = fds[1];
+#endif
+
+        for (size_t i = 0; i < workers; i++) {
+            this->threads.emplace_back([this] { this->Work(); });
+        }
+    }
+
+    Executor(const Executor &) = delete;
+    Executor &operator=(const Executor &) = delete;
+
+    ~Executor() {
+        this->Shutdown();
+
+        close(this->read_fd);
+        if (this->write_fd != this->read_fd) {
+            close(this->write_fd);
+        }
+    }
+
+    int FileDescriptor() const {
+        return this->read_fd;
+    }
+
+    // `owner` (the python object `func` works on) is kept alive until the result is drained. The worker thread
+    // only moves it, the reference is dropped by Drain with the GIL held
+    template <typename Func>
+    void Submit(uint64_t id, py::object owner, Func func) {
+        {
+            std::lock_guard<std::mutex> guard(this->tasks_mutex);
+            if (this->stopped) {
+                throw std::runtime_error("Cannot invoke request executor shut down");
+            }
+
+            this->tasks.emplace_back([this, id, owner = std::move(owner), func = std::move(func)]() mutable {
+                Result result;
+                try {
+                    auto value = func();
+                    result = [owner = std::move(owner), value = std::move(value)]() { return py::cast(value); };
+                } catch (const std::exception &e) {
+                    result = [owner = std::move(owner), message = std::string(e.what())]() -> py::object {
+                        throw std::runtime_error(message);
+                    };
+                }
+
+                this->Complete(id, std::move(result));
+            });
+        }
+
+        this->tasks_cv.notify_one();
+    }
+
+    // Returns a list of (id, result, error) for every request completed since the last call
+    py::list Drain() {
+        // Consume the signal before taking the queue, a completion racing with us signals again
+        uint64_t buffer[8];
+        while (read(this->read_fd, buffer, sizeof(buffer)) > 0) {
+        }
+
+        std::vector<std::pair<uint64_t, Result>> done;
+        {
+            std::lock_guard<std::mutex> guard(this->done_mutex);
+            done.swap(this->done);
+            this->signalled = false;
+        }
+
+        py::list results;
+        for (auto &[id, result] : done) {
+            try {
+                results.append(py::make_tuple(id, result(), py::none()));
+            } catch (const std::exception &e) {
+                results.append(py::make_tuple(id, py::none(), py::str(e.what())));
+            }
+        }
+
+        return results;
+    }
+
+    void Shutdown() {
+        {
+            std::lock_guard<std::mutex> guard(this->tasks_mutex);
+            if (this->stopped) {
+                return;
+            }
+            this->stopped = true;
+        }
+
+        this->tasks_cv.notify_all();
+        for (auto &thread : this->threads) {
+            thread.join();
+        }
+    }
+
+   private:
+    int read_fd;
+    int write_fd;
+    std::vector<std::thread> threads;
+
+    std::mutex tasks_mutex;
+    std::condition_variable tasks_cv;
+    std::deque<std::function<void()>> tasks;
+    bool stopped = false;
+
+    std::mutex done_mutex;
+    std::vector<std::pair<uint64_t, Result>> done;
+    bool signalled = false;
+
+    void Work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(this->tasks_mutex);
+                this->tasks_cv.wait(lock, [this] { return this->stopped || !this->tasks.empty(); });
+
+                // Pending requests are still run on shutdown so their futures complete
+                if (this->tasks.empty()) {
+                    return;
+                }
+
+                task = std::move(this->tasks.front());
+                this->tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    void Complete(uint64_t id, Result result) {
+        bool signal;
+        {
+            std::lock_guard<std::mutex> guard(this->done_mutex);
+            this->done.emplace_back(id, std::move(result));
+            signal = !this->signalled;
+            this->signalled = true;
+        }
+
+        if (signal) {
+            uint64_t one = 1;
+            while (write(this->write_fd, &one, sizeof(one)) < 0 && errno == EINTR) {
+            }
+        }
+    }
+};
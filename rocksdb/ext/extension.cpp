@@ -1,38 +1,868 @@
+#include "backup.hpp"
+#include "compaction_filter.hpp"
+#include "executor.hpp"
+#include "merge_operators.hpp"
 #include "rocksdb.hpp"
+#include "sst_file_writer.hpp"
+#include "statistics.hpp"
+#include "transaction.hpp"
 using namespace py::literals;
 
+// Column family fields shared by rocksdb::Options and rocksdb::ColumnFamilyOptions
+template <typename T>
+void BindColumnFamilyOptions(py::class_<T> &instance) {
+    instance.def_readwrite("max_write_buffer_number", &T::max_write_buffer_number)
+        .def_readwrite("min_write_buffer_number_to_merge", &T::min_write_buffer_number_to_merge)
+        .def_readwrite("level0_slowdown_writes_trigger", &T::level0_slowdown_writes_trigger)
+        .def_readwrite("level0_stop_writes_trigger", &T::level0_stop_writes_trigger)
+        .def_readwrite("max_bytes_for_level_multiplier", &T::max_bytes_for_level_multiplier)
+        .def_readwrite("target_file_size_base", &T::target_file_size_base)
+        .def_readwrite("num_levels", &T::num_levels)
+        .def_readwrite("level_compaction_dynamic_level_bytes", &T::level_compaction_dynamic_level_bytes)
+        .def_readwrite("compaction_style", &T::compaction_style)
+        .def_readwrite("compression", &T::compression)
+        .def_readwrite("bottommost_compression", &T::bottommost_compression)
+        .def_readwrite("memtable_prefix_bloom_size_ratio", &T::memtable_prefix_bloom_size_ratio)
+        .def_readwrite("optimize_filters_for_hits", &T::optimize_filters_for_hits)
+        .def_property(
+            "prefix_extractor",
+            [](const T &instance) {
+                return std::const_pointer_cast<rocksdb::SliceTransform>(instance.prefix_extractor);
+            },
+            [](T &instance, std::shared_ptr<rocksdb::SliceTransform> value) { instance.prefix_extractor = value; })
+        .def_readwrite("compaction_filter_factory", &T::compaction_filter_factory)
+        .def_readwrite("merge_operator", &T::merge_operator)
+        // Integrated BlobDB, values of at least `min_blob_size` bytes are written to blob files and compactions only
+        // move their references
+        .def_readwrite("enable_blob_files", &T::enable_blob_files)
+        .def_readwrite("min_blob_size", &T::min_blob_size)
+        .def_readwrite("blob_file_size", &T::blob_file_size)
+        .def_readwrite("blob_compression_type", &T::blob_compression_type)
+        .def_readwrite("enable_blob_garbage_collection", &T::enable_blob_garbage_collection)
+        .def_readwrite("blob_garbage_collection_age_cutoff", &T::blob_garbage_collection_age_cutoff)
+        .def_readwrite("blob_garbage_collection_force_threshold", &T::blob_garbage_collection_force_threshold)
+        .def_readwrite("blob_compaction_readahead_size", &T::blob_compaction_readahead_size)
+        .def_readwrite("blob_file_starting_level", &T::blob_file_starting_level)
+        .def_readwrite("blob_cache", &T::blob_cache)
+        .def_readwrite("prepopulate_blob_cache", &T::prepopulate_blob_cache)
+        // The options of the table factory itself, so `options.table_options.block_size = ...` is kept. A factory
+        // shared with a copy of the options (or a database opened with them) is cloned first
+        .def_property(
+            "table_options",
+            [](T &instance) -> rocksdb::BlockBasedTableOptions * {
+                auto *table_options = instance.table_factory->template GetOptions<rocksdb::BlockBasedTableOptions>();
+                if (table_options != nullptr && instance.table_factory.use_count() > 1) {
+                    instance.table_factory.reset(rocksdb::NewBlockBasedTableFactory(*table_options));
+                    table_options = instance.table_factory->template GetOptions<rocksdb::BlockBasedTableOptions>();
+                }
+                return table_options;
+            },
+            [](T &instance, rocksdb::BlockBasedTableOptions &value) {
+                instance.table_factory.reset(rocksdb::NewBlockBasedTableFactory(value));
+            },
+            py::return_value_policy::reference_internal);
+}
+
 PYBIND11_MODULE(rocksdb_ext, m) {
+    // Registered first, it is a default argument of RocksDBext
+    py::enum_<TransactionDBType>(m, "TransactionDBType")
+        .value("none", TransactionDBType::kNone)
+        .value("pessimistic", TransactionDBType::kPessimistic)
+        .value("optimistic", TransactionDBType::kOptimistic);
+
     py::class_<RocksDB>(m, "RocksDBext")
-        .def(py::init<std::string, rocksdb::Options &, bool, std::string *>())
+        .def(py::init<std::string, rocksdb::Options &, bool, std::string *,
+                      std::map<std::string, rocksdb::ColumnFamilyOptions>, TransactionDBType,
+                      rocksdb::TransactionDBOptions *>(),
+             py::arg("db_path"), py::arg("options"), py::arg("read_only") = false,
+             py::arg("secondary_path") = py::none(),
+             py::arg("column_families") = std::map<std::string, rocksdb::ColumnFamilyOptions>(),
+             py::arg("transaction_db") = TransactionDBType::kNone, py::arg("transaction_db_options") = py::none(),
+             release_gil())
         .def_readonly("is_running", &RocksDB::is_running)
-        .def("Get", &RocksDB::Get, py::arg("readOptions"), py::arg("key"), py::return_value_policy::move)
+        .def("CreateColumnFamily", &RocksDB::CreateColumnFamily, py::arg("columnFamilyOptions"), py::arg("name"),
+             release_gil())
+        .def("DropColumnFamily", &RocksDB::DropColumnFamily, py::arg("columnFamily"), py::return_value_policy::move,
+             release_gil())
+        .def("GetColumnFamily", &RocksDB::GetColumnFamily, py::arg("name"))
+        .def("ListColumnFamilies", &RocksDB::ListColumnFamilies)
+        .def_static("ListColumnFamiliesOnDisk", &RocksDB::ListColumnFamiliesOnDisk, py::arg("options"),
+                    py::arg("db_path"), release_gil())
+        .def("Get", &RocksDB::Get, py::arg("readOptions"), py::arg("key"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("MultiGet", &RocksDB::MultiGet, py::arg("readOptions"), py::arg("keys"),
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
         .def("Put", &RocksDB::Put, py::arg("writeOptions"), py::arg("key"), py::arg("value"),
-             py::return_value_policy::move)
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
         .def("Merge", &RocksDB::Merge, py::arg("writeOptions"), py::arg("key"), py::arg("value"),
-             py::return_value_policy::move)
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
+        .def("Write", &RocksDB::Write, py::arg("writeOptions"), py::arg("batch"), py::return_value_policy::move,
+             release_gil())
+        .def("GetFromBatchAndDB", &RocksDB::GetFromBatchAndDB, py::arg("readOptions"), py::arg("batch"),
+             py::arg("key"), py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
         .def("KeyMayExist", &RocksDB::KeyMayExist, py::arg("readOptions"), py::arg("key"),
-             py::return_value_policy::move)
-        .def("Del", &RocksDB::Del, py::arg("writeOptions"), py::arg("key"), py::return_value_policy::move)
-        .def("GetOptions", &RocksDB::GetOptions, py::return_value_policy::move)
-        .def("SetOptions", &RocksDB::SetOptions, py::arg("options"), py::return_value_policy::move)
-        .def("SetDBOptions", &RocksDB::SetDBOptions, py::arg("options"), py::return_value_policy::move)
-        .def("GetProperty", &RocksDB::GetProperty, py::arg("key"), py::return_value_policy::move)
-        .def("Flush", &RocksDB::Flush, py::arg("flushOptions"), py::return_value_policy::move)
-        .def("TryCatchUpWithPrimary", &RocksDB::TryCatchUpWithPrimary, py::return_value_policy::move)
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
+        .def("Del", &RocksDB::Del, py::arg("writeOptions"), py::arg("key"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("DeleteRange", &RocksDB::DeleteRange, py::arg("writeOptions"), py::arg("begin_key"), py::arg("end_key"),
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
+        .def("PutEntity", &RocksDB::PutEntity, py::arg("writeOptions"), py::arg("key"), py::arg("columns"),
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
+        .def("GetEntity", &RocksDB::GetEntity, py::arg("readOptions"), py::arg("key"), py::arg("names") = py::none(),
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
+        .def("GetOptions", &RocksDB::GetOptions, py::arg("columnFamily") = py::none(), py::return_value_policy::move,
+             release_gil())
+        .def("SetOptions", &RocksDB::SetOptions, py::arg("options"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("SetDBOptions", &RocksDB::SetDBOptions, py::arg("options"), py::return_value_policy::move,
+             release_gil())
+        .def("GetProperty", &RocksDB::GetProperty, py::arg("key"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("GetMapProperty", &RocksDB::GetMapProperty, py::arg("key"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("GetIntProperties", &RocksDB::GetIntProperties, py::arg("keys"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("Flush", &RocksDB::Flush, py::arg("flushOptions"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("CompactRange", &RocksDB::CompactRange, py::arg("compactRangeOptions"), py::arg("begin") = py::none(),
+             py::arg("end") = py::none(), py::arg("columnFamily") = py::none(), py::return_value_policy::move,
+             release_gil())
+        .def("CompactFiles", &RocksDB::CompactFiles, py::arg("compactionOptions"), py::arg("files"),
+             py::arg("output_level"), py::arg("columnFamily") = py::none(), py::return_value_policy::move,
+             release_gil())
+        .def("SuggestCompactRange", &RocksDB::SuggestCompactRange, py::arg("begin") = py::none(),
+             py::arg("end") = py::none(), py::arg("columnFamily") = py::none(), py::return_value_policy::move,
+             release_gil())
+        .def("EnableAutoCompaction", &RocksDB::EnableAutoCompaction,
+             py::arg("columnFamilies") = std::vector<ColumnFamily *>(), py::return_value_policy::move, release_gil())
+        .def("CreateCheckpoint", &RocksDB::CreateCheckpoint, py::arg("checkpoint_dir"),
+             py::arg("log_size_for_flush") = 0, py::return_value_policy::move, release_gil())
+        .def("IngestExternalFile", &RocksDB::IngestExternalFile, py::arg("files"), py::arg("ingestOptions"),
+             py::arg("columnFamily") = py::none(), py::return_value_policy::move, release_gil())
+        .def("TryCatchUpWithPrimary", &RocksDB::TryCatchUpWithPrimary, py::return_value_policy::move,
+             release_gil())
+        .def("GetLatestSequenceNumber", &RocksDB::GetLatestSequenceNumber, release_gil())
+        .def("StartAutoCatchUp", &RocksDB::StartAutoCatchUp, py::arg("interval"), py::arg("watch_files") = false,
+             py::arg("min_interval") = 100, py::return_value_policy::move, release_gil())
+        .def("StopAutoCatchUp", &RocksDB::StopAutoCatchUp, py::return_value_policy::move, release_gil())
+        .def("GetCatchUpStats", &RocksDB::GetCatchUpStats, release_gil())
         .def_static("GetRocksBuildProperties", &RocksDB::GetRocksBuildProperties)
         .def_static("GetRocksVersionAsString", &RocksDB::GetRocksVersionAsString, py::return_value_policy::move)
         .def_static("GetRocksBuildInfoAsString", &RocksDB::GetRocksBuildInfoAsString, py::return_value_policy::move)
-        .def("Close", &RocksDB::Close, py::return_value_policy::move);
+        .def("Close", &RocksDB::Close, py::return_value_policy::move, release_gil());
+
+    py::class_<ColumnFamily, std::shared_ptr<ColumnFamily>>(m, "ColumnFamily")
+        .def_readonly("name", &ColumnFamily::name)
+        .def_property_readonly("is_dropped", [](const ColumnFamily &instance) { return instance.handle == nullptr; })
+        .def("__repr__", [](const ColumnFamily &instance) { return "ColumnFamily('" + instance.name + "')"; });
+
+    // Arguments are copied, the request outlives the python call that submitted it. It holds a reference to `db`
+    // until its result is drained, so the database cannot be collected while the request is queued
+    py::class_<Executor>(m, "_Executor")
+        .def(py::init<size_t>(), py::arg("workers"))
+        .def_property_readonly("fd", &Executor::FileDescriptor)
+        .def("Drain", &Executor::Drain)
+        .def("Shutdown", &Executor::Shutdown, release_gil())
+        .def(
+            "Get",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::ReadOptions options, rocksdb::Slice key,
+               std::shared_ptr<ColumnFamily> column_family) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, key = key.ToString(), column_family]() mutable {
+                    return db.Get(options, key, column_family.get());
+                });
+            },
+            py::arg("id"), py::arg("db"), py::arg("readOptions"), py::arg("key"), py::arg("columnFamily") = py::none())
+        .def(
+            "MultiGet",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::ReadOptions options,
+               std::vector<std::string> keys, std::shared_ptr<ColumnFamily> column_family) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, keys = std::move(keys), column_family]() mutable {
+                    return db.MultiGet(options, keys, column_family.get());
+                });
+            },
+            py::arg("id"), py::arg("db"), py::arg("readOptions"), py::arg("keys"), py::arg("columnFamily") = py::none())
+        .def(
+            "KeyMayExist",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::ReadOptions options, rocksdb::Slice key,
+               std::shared_ptr<ColumnFamily> column_family) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, key = key.ToString(), column_family]() mutable {
+                    return db.KeyMayExist(options, key, column_family.get());
+                });
+            },
+            py::arg("id"), py::arg("db"), py::arg("readOptions"), py::arg("key"), py::arg("columnFamily") = py::none())
+        .def(
+            "Put",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::WriteOptions options, rocksdb::Slice key,
+               rocksdb::Slice value, std::shared_ptr<ColumnFamily> column_family) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, key = key.ToString(), value = value.ToString(),
+                                            column_family]() mutable {
+                    return db.Put(options, key, value, column_family.get());
+                });
+            },
+            py::arg("id"), py::arg("db"), py::arg("writeOptions"), py::arg("key"), py::arg("value"),
+            py::arg("columnFamily") = py::none())
+        .def(
+            "Merge",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::WriteOptions options, rocksdb::Slice key,
+               rocksdb::Slice value, std::shared_ptr<ColumnFamily> column_family) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, key = key.ToString(), value = value.ToString(),
+                                            column_family]() mutable {
+                    return db.Merge(options, key, value, column_family.get());
+                });
+            },
+            py::arg("id"), py::arg("db"), py::arg("writeOptions"), py::arg("key"), py::arg("value"),
+            py::arg("columnFamily") = py::none())
+        .def(
+            "Del",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::WriteOptions options, rocksdb::Slice key,
+               std::shared_ptr<ColumnFamily> column_family) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, key = key.ToString(), column_family]() mutable {
+                    return db.Del(options, key, column_family.get());
+                });
+            },
+            py::arg("id"), py::arg("db"), py::arg("writeOptions"), py::arg("key"), py::arg("columnFamily") = py::none())
+        .def(
+            "Write",
+            [](Executor &instance, uint64_t id, py::object owner, rocksdb::WriteOptions options,
+               std::shared_ptr<rocksdb::WriteBatchBase> batch) {
+                RocksDB &db = owner.cast<RocksDB &>();
+                instance.Submit(id, owner, [&db, options, batch]() mutable { return db.Write(options, *batch); });
+            },
+            py::arg("id"), py::arg("db"), py::arg("writeOptions"), py::arg("batch"));
+
+    py::class_<Snapshot, std::shared_ptr<Snapshot>>(m, "Snapshot")
+        .def(py::init<RocksDB &>(), py::arg("db"), py::keep_alive<1, 2>())
+        .def_property_readonly("sequence_number", &Snapshot::SequenceNumber)
+        .def_property_readonly("is_released", &Snapshot::IsReleased)
+        .def("Release", &Snapshot::Release, release_gil())
+        .def("__repr__", [](Snapshot &instance) {
+            if (instance.IsReleased()) {
+                return std::string("Snapshot(released)");
+            }
+            return "Snapshot(" + std::to_string(instance.SequenceNumber()) + ")";
+        });
+
+    py::class_<Iterator>(m, "_Iterator")
+        .def(py::init<RocksDB &, rocksdb::ReadOptions &, std::optional<std::string>, std::optional<std::string>,
+                      ColumnFamily *>(),
+             py::arg("db"), py::arg("readOptions"), py::arg("lower_bound") = py::none(),
+             py::arg("upper_bound") = py::none(), py::arg("columnFamily") = py::none(), py::keep_alive<1, 2>())
+        .def("Valid", &Iterator::Valid, release_gil())
+        .def("SeekToFirst", &Iterator::SeekToFirst, release_gil())
+        .def("SeekToLast", &Iterator::SeekToLast, release_gil())
+        .def("Seek", &Iterator::Seek, py::arg("key"), release_gil())
+        .def("SeekForPrev", &Iterator::SeekForPrev, py::arg("key"), release_gil())
+        .def("Next", &Iterator::Next, release_gil())
+        .def("Prev", &Iterator::Prev, release_gil())
+        .def("Key", &Iterator::Key, release_gil())
+        .def("Value", &Iterator::Value, release_gil())
+        .def("Status", &Iterator::Status, release_gil())
+        .def("Chunk", &Iterator::Chunk, py::arg("count"), py::arg("reverse") = false, release_gil())
+        .def("Close", &Iterator::Close, release_gil());
+
+    py::class_<Transaction>(m, "_Transaction")
+        .def(py::init<RocksDB &, rocksdb::WriteOptions &, rocksdb::TransactionOptions &>(), py::arg("db"),
+             py::arg("writeOptions"), py::arg("transactionOptions"), py::keep_alive<1, 2>(), release_gil())
+        .def("Get", &Transaction::Get, py::arg("readOptions"), py::arg("key"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("GetForUpdate", &Transaction::GetForUpdate, py::arg("readOptions"), py::arg("key"),
+             py::arg("columnFamily") = py::none(), py::arg("exclusive") = true, py::return_value_policy::move,
+             release_gil())
+        .def("Put", &Transaction::Put, py::arg("key"), py::arg("value"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("Merge", &Transaction::Merge, py::arg("key"), py::arg("value"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("Del", &Transaction::Del, py::arg("key"), py::arg("columnFamily") = py::none(),
+             py::return_value_policy::move, release_gil())
+        .def("SetSnapshot", &Transaction::SetSnapshot, release_gil())
+        .def("SetSavePoint", &Transaction::SetSavePoint, release_gil())
+        .def("RollbackToSavePoint", &Transaction::RollbackToSavePoint, py::return_value_policy::move, release_gil())
+        .def("PopSavePoint", &Transaction::PopSavePoint, py::return_value_policy::move, release_gil())
+        .def("SetLockTimeout", &Transaction::SetLockTimeout, py::arg("timeout"), release_gil())
+        .def("Commit", &Transaction::Commit, py::return_value_policy::move, release_gil())
+        .def("Rollback", &Transaction::Rollback, py::return_value_policy::move, release_gil())
+        .def("GetNumKeys", &Transaction::GetNumKeys, release_gil())
+        .def("Close", &Transaction::Close, release_gil());
+
+    py::class_<Value, std::shared_ptr<Value>>(m, "Value", py::buffer_protocol())
+        .def_buffer([](Value &instance) {
+            return py::buffer_info(const_cast<char *>(instance.slice.data()), 1,
+                                   py::format_descriptor<uint8_t>::format(), 1, {instance.slice.size()}, {1}, true);
+        })
+        .def("__len__", [](const Value &instance) { return instance.slice.size(); })
+        .def("__bytes__", [](const Value &instance) { return py::bytes(instance.slice.data(), instance.slice.size()); })
+        .def("__str__", [](const Value &instance) { return py::str(instance.slice.data(), instance.slice.size()); })
+        .def("__repr__",
+             [](const Value &instance) {
+                 py::bytes value(instance.slice.data(), instance.slice.size());
+                 return "Value(" + std::string(py::repr(value)) + ")";
+             })
+        .def("__eq__", [](const Value &instance, const Value &other) { return instance.slice == other.slice; })
+        .def("__eq__", [](const Value &instance, rocksdb::Slice other) { return instance.slice == other; })
+        .def("__hash__", [](const Value &instance) {
+            return py::hash(py::bytes(instance.slice.data(), instance.slice.size()));
+        });
 
     py::class_<Response>(m, "Response")
-        .def(py::init<rocksdb::Status &, std::string *>())
-        .def_readwrite("status", &Response::status)
-        .def_readwrite("options", &Response::options)
+        .def(py::init<rocksdb::Status, std::shared_ptr<Value>>(), py::arg("status"), py::arg("value") = nullptr)
+        .def_property(
+            "status", [](const Response &instance) { return CastStatus(instance.status); },
+            [](Response &instance, rocksdb::Status &s) { instance.status = s; })
         .def_readwrite("value", &Response::value);
 
-    // RocksDB options aka rocksdb::Options
-    py::class_<rocksdb::Options>(m, "_Options")
+    py::class_<OptionsResponse>(m, "OptionsResponse")
+        .def_property_readonly("status", [](const OptionsResponse &instance) { return CastStatus(instance.status); })
+        .def_readonly("options", &OptionsResponse::options);
+
+    py::class_<PropertiesResponse>(m, "PropertiesResponse")
+        .def_property_readonly("status",
+                               [](const PropertiesResponse &instance) { return CastStatus(instance.status); })
+        .def_readonly("properties", &PropertiesResponse::properties);
+
+    py::class_<EntityResponse>(m, "EntityResponse")
+        .def_property_readonly("status", [](const EntityResponse &instance) { return CastStatus(instance.status); })
+        .def_property_readonly("columns", [](const EntityResponse &instance) {
+            py::dict columns;
+            for (auto &[name, value] : instance.columns) {
+                columns[py::bytes(name)] = py::bytes(value);
+            }
+            return columns;
+        });
+
+    py::class_<CatchUpStats>(m, "CatchUpStats")
+        .def_readonly("catch_ups", &CatchUpStats::catch_ups)
+        .def_readonly("failures", &CatchUpStats::failures)
+        .def_property_readonly("last_status",
+                               [](const CatchUpStats &instance) { return CastStatus(instance.last_status); })
+        .def_readonly("last_duration", &CatchUpStats::last_duration)
+        .def_readonly("last_sequence_delta", &CatchUpStats::last_sequence_delta)
+        .def_readonly("sequence_number", &CatchUpStats::sequence_number)
+        .def_property_readonly("staleness", &CatchUpStats::Staleness)
+        .def("to_dict", [](const CatchUpStats &instance) {
+            return py::dict("catch_ups"_a = instance.catch_ups, "failures"_a = instance.failures,
+                            "last_status"_a = instance.last_status.ToString(),
+                            "last_duration"_a = instance.last_duration,
+                            "last_sequence_delta"_a = instance.last_sequence_delta,
+                            "sequence_number"_a = instance.sequence_number, "staleness"_a = instance.Staleness());
+        });
+
+    py::class_<MultiResponse>(m, "MultiResponse")
+        .def_property_readonly("statuses",
+                               [](const MultiResponse &instance) {
+                                   py::list statuses(instance.statuses.size());
+                                   for (size_t i = 0; i < instance.statuses.size(); i++) {
+                                       statuses[i] = CastStatus(instance.statuses[i]);
+                                   }
+                                   return statuses;
+                               })
+        .def_readonly("values", &MultiResponse::values)
+        .def("__len__", [](const MultiResponse &instance) { return instance.statuses.size(); });
+
+    // RocksDB WriteBatchBase aka rocksdb::WriteBatchBase
+    py::class_<rocksdb::WriteBatchBase, std::shared_ptr<rocksdb::WriteBatchBase>>(m, "_WriteBatchBase")
+        .def(
+            "Put",
+            [](rocksdb::WriteBatchBase &instance, rocksdb::Slice key, rocksdb::Slice value,
+               ColumnFamily *column_family) { return instance.Put(BatchHandle(column_family), key, value); },
+            py::arg("key"), py::arg("value"), py::arg("columnFamily") = py::none())
+        .def(
+            "PutMany",
+            [](rocksdb::WriteBatchBase &instance, std::vector<std::pair<std::string, std::string>> &items,
+               ColumnFamily *column_family) {
+                rocksdb::ColumnFamilyHandle *handle = BatchHandle(column_family);
+                for (auto &item : items) {
+                    status s = instance.Put(handle, item.first, item.second);
+                    if (!s.ok()) {
+                        return s;
+                    }
+                }
+                return status::OK();
+            },
+            py::arg("items"), py::arg("columnFamily") = py::none(), release_gil())
+        .def(
+            "Merge",
+            [](rocksdb::WriteBatchBase &instance, rocksdb::Slice key, rocksdb::Slice value,
+               ColumnFamily *column_family) { return instance.Merge(BatchHandle(column_family), key, value); },
+            py::arg("key"), py::arg("value"), py::arg("columnFamily") = py::none())
+        .def(
+            "Delete",
+            [](rocksdb::WriteBatchBase &instance, rocksdb::Slice key, ColumnFamily *column_family) {
+                return instance.Delete(BatchHandle(column_family), key);
+            },
+            py::arg("key"), py::arg("columnFamily") = py::none())
+        .def(
+            "SingleDelete",
+            [](rocksdb::WriteBatchBase &instance, rocksdb::Slice key, ColumnFamily *column_family) {
+                return instance.SingleDelete(BatchHandle(column_family), key);
+            },
+            py::arg("key"), py::arg("columnFamily") = py::none())
+        .def(
+            "DeleteRange",
+            [](rocksdb::WriteBatchBase &instance, rocksdb::Slice begin_key, rocksdb::Slice end_key,
+               ColumnFamily *column_family) {
+                return instance.DeleteRange(BatchHandle(column_family), begin_key, end_key);
+            },
+            py::arg("begin_key"), py::arg("end_key"), py::arg("columnFamily") = py::none())
+        .def("Clear", &rocksdb::WriteBatchBase::Clear)
+        .def("SetSavePoint", &rocksdb::WriteBatchBase::SetSavePoint)
+        .def("RollbackToSavePoint", &rocksdb::WriteBatchBase::RollbackToSavePoint)
+        .def("__len__", [](rocksdb::WriteBatchBase &instance) { return instance.GetWriteBatch()->Count(); })
+        .def_property_readonly("data_size", [](rocksdb::WriteBatchBase &instance) {
+            return instance.GetWriteBatch()->GetDataSize();
+        });
+
+    // RocksDB WriteBatch aka rocksdb::WriteBatch
+    py::class_<rocksdb::WriteBatch, rocksdb::WriteBatchBase, std::shared_ptr<rocksdb::WriteBatch>>(m, "WriteBatch")
+        .def(py::init<size_t, size_t>(), py::arg("reserved_bytes") = 0, py::arg("max_bytes") = 0);
+
+    // RocksDB WriteBatchWithIndex aka rocksdb::WriteBatchWithIndex
+    py::class_<rocksdb::WriteBatchWithIndex, rocksdb::WriteBatchBase, std::shared_ptr<rocksdb::WriteBatchWithIndex>>(
+        m, "WriteBatchWithIndex")
+        .def(py::init([](size_t reserved_bytes, bool overwrite_key) {
+                 return std::make_shared<rocksdb::WriteBatchWithIndex>(rocksdb::BytewiseComparator(), reserved_bytes,
+                                                                       overwrite_key);
+             }),
+             py::arg("reserved_bytes") = 0, py::arg("overwrite_key") = false)
+        .def(
+            "GetFromBatch",
+            [](rocksdb::WriteBatchWithIndex &instance, rocksdb::Options &options, rocksdb::Slice key) {
+                std::string value;
+                status s = instance.GetFromBatch(options, key, &value);
+                return Response(s, std::make_shared<Value>(std::move(value)));
+            },
+            py::arg("options"), py::arg("key"), py::return_value_policy::move);
+
+    // RocksDB ExternalSstFileInfo aka rocksdb::ExternalSstFileInfo
+    py::class_<rocksdb::ExternalSstFileInfo>(m, "ExternalSstFileInfo")
+        .def_readonly("file_path", &rocksdb::ExternalSstFileInfo::file_path)
+        .def_property_readonly("smallest_key",
+                               [](const rocksdb::ExternalSstFileInfo &instance) {
+                                   return py::bytes(instance.smallest_key);
+                               })
+        .def_property_readonly("largest_key",
+                               [](const rocksdb::ExternalSstFileInfo &instance) {
+                                   return py::bytes(instance.largest_key);
+                               })
+        .def_readonly("sequence_number", &rocksdb::ExternalSstFileInfo::sequence_number)
+        .def_readonly("file_size", &rocksdb::ExternalSstFileInfo::file_size)
+        .def_readonly("num_entries", &rocksdb::ExternalSstFileInfo::num_entries)
+        .def("__repr__", [](const rocksdb::ExternalSstFileInfo &instance) {
+            return "ExternalSstFileInfo('" + instance.file_path + "', " + std::to_string(instance.num_entries) +
+                   " entries)";
+        });
+
+    py::class_<SstFileResponse>(m, "SstFileResponse")
+        .def_property_readonly("status", [](const SstFileResponse &instance) { return CastStatus(instance.status); })
+        .def_readonly("files", &SstFileResponse::files)
+        .def_property_readonly("file_paths", [](const SstFileResponse &instance) {
+            std::vector<std::string> paths;
+            for (auto &file : instance.files) {
+                paths.push_back(file.file_path);
+            }
+            return paths;
+        });
+
+    // RocksDB SstFileWriter aka rocksdb::SstFileWriter
+    py::class_<SstFileWriter>(m, "SstFileWriter")
+        .def(py::init<rocksdb::Options &>(), py::arg("options"))
+        .def("Open", &SstFileWriter::Open, py::arg("file_path"), release_gil())
+        .def("Put", &SstFileWriter::Put, py::arg("key"), py::arg("value"), release_gil())
+        .def("PutMany", &SstFileWriter::PutMany, py::arg("items"), py::arg("sort") = false, release_gil())
+        .def("Merge", &SstFileWriter::Merge, py::arg("key"), py::arg("value"), release_gil())
+        .def("Delete", &SstFileWriter::Delete, py::arg("key"), release_gil())
+        .def("DeleteRange", &SstFileWriter::DeleteRange, py::arg("begin_key"), py::arg("end_key"), release_gil())
+        .def("Finish", &SstFileWriter::Finish, py::return_value_policy::move, release_gil())
+        .def_property_readonly("file_size", &SstFileWriter::FileSize)
+        // Takes the GIL only to read `items`, without sort the files are written while the next chunk is read
+        .def_static("Generate", &SstFileWriter::Generate, py::arg("options"), py::arg("items"), py::arg("path_prefix"),
+                    py::arg("threads") = std::max(1u, std::thread::hardware_concurrency()), py::arg("sort") = true,
+                    py::arg("chunk_size") = 1000000, py::return_value_policy::move);
+
+    // RocksDB Cache aka rocksdb::Cache, share one instance between databases to bound their block cache memory
+    py::class_<rocksdb::Cache, std::shared_ptr<rocksdb::Cache>>(m, "Cache")
+        .def_static(
+            "NewLRUCache",
+            [](size_t capacity, int num_shard_bits, bool strict_capacity_limit, double high_pri_pool_ratio) {
+                return rocksdb::NewLRUCache(capacity, num_shard_bits, strict_capacity_limit, high_pri_pool_ratio);
+            },
+            py::arg("capacity"), py::arg("num_shard_bits") = -1, py::arg("strict_capacity_limit") = false,
+            py::arg("high_pri_pool_ratio") = 0.5)
+#if ROCKSDB_MAJOR > 7 || (ROCKSDB_MAJOR == 7 && ROCKSDB_MINOR >= 8)
+        .def_static(
+            "NewHyperClockCache",
+            [](size_t capacity, size_t estimated_entry_charge, int num_shard_bits, bool strict_capacity_limit) {
+                return rocksdb::HyperClockCacheOptions(capacity, estimated_entry_charge, num_shard_bits,
+                                                       strict_capacity_limit)
+                    .MakeSharedCache();
+            },
+            py::arg("capacity"), py::arg("estimated_entry_charge") = 0, py::arg("num_shard_bits") = -1,
+            py::arg("strict_capacity_limit") = false)
+#endif
+        .def_property_readonly("name", &rocksdb::Cache::Name)
+        .def_property("capacity", &rocksdb::Cache::GetCapacity, &rocksdb::Cache::SetCapacity)
+        .def_property("strict_capacity_limit", &rocksdb::Cache::HasStrictCapacityLimit,
+                      &rocksdb::Cache::SetStrictCapacityLimit)
+        .def_property_readonly("usage", py::overload_cast<>(&rocksdb::Cache::GetUsage, py::const_))
+        .def_property_readonly("pinned_usage", &rocksdb::Cache::GetPinnedUsage)
+        .def("to_dict", [](const rocksdb::Cache &instance) {
+            return py::dict("name"_a = instance.Name(), "capacity"_a = instance.GetCapacity(),
+                            "usage"_a = instance.GetUsage(), "pinned_usage"_a = instance.GetPinnedUsage(),
+                            "strict_capacity_limit"_a = instance.HasStrictCapacityLimit());
+        });
+
+    py::enum_<rocksdb::RateLimiter::Mode>(m, "RateLimiterMode")
+        .value("reads_only", rocksdb::RateLimiter::Mode::kReadsOnly)
+        .value("writes_only", rocksdb::RateLimiter::Mode::kWritesOnly)
+        .value("all_io", rocksdb::RateLimiter::Mode::kAllIo);
+
+    // RocksDB RateLimiter aka rocksdb::RateLimiter, share one instance to bound the flush and compaction IO of
+    // several databases together
+    py::class_<rocksdb::RateLimiter, std::shared_ptr<rocksdb::RateLimiter>>(m, "RateLimiter")
+        .def_static(
+            "NewGenericRateLimiter",
+            [](int64_t rate_bytes_per_sec, int64_t refill_period_us, int32_t fairness, rocksdb::RateLimiter::Mode mode,
+               bool auto_tuned) {
+                return std::shared_ptr<rocksdb::RateLimiter>(
+                    rocksdb::NewGenericRateLimiter(rate_bytes_per_sec, refill_period_us, fairness, mode, auto_tuned));
+            },
+            py::arg("rate_bytes_per_sec"), py::arg("refill_period_us") = 100 * 1000, py::arg("fairness") = 10,
+            py::arg("mode") = rocksdb::RateLimiter::Mode::kWritesOnly, py::arg("auto_tuned") = false)
+        .def_property("bytes_per_second", &rocksdb::RateLimiter::GetBytesPerSecond,
+                      &rocksdb::RateLimiter::SetBytesPerSecond)
+        .def_property_readonly("single_burst_bytes", &rocksdb::RateLimiter::GetSingleBurstBytes)
+        .def_property_readonly("total_bytes_through",
+                               [](rocksdb::RateLimiter &instance) { return instance.GetTotalBytesThrough(); })
+        .def_property_readonly("total_requests",
+                               [](rocksdb::RateLimiter &instance) { return instance.GetTotalRequests(); })
+        .def("to_dict", [](rocksdb::RateLimiter &instance) {
+            return py::dict("bytes_per_second"_a = instance.GetBytesPerSecond(),
+                            "single_burst_bytes"_a = instance.GetSingleBurstBytes(),
+                            "total_bytes_through"_a = instance.GetTotalBytesThrough(),
+                            "total_requests"_a = instance.GetTotalRequests());
+        });
+
+    // RocksDB WriteBufferManager aka rocksdb::WriteBufferManager, share one instance to cap the memtable memory of
+    // several databases. With a `cache` the memtables are charged to it, so one budget covers both
+    py::class_<rocksdb::WriteBufferManager, std::shared_ptr<rocksdb::WriteBufferManager>>(m, "WriteBufferManager")
+        .def(py::init<size_t, std::shared_ptr<rocksdb::Cache>, bool>(), py::arg("buffer_size"),
+             py::arg("cache") = nullptr, py::arg("allow_stall") = false)
+        .def_property_readonly("enabled", &rocksdb::WriteBufferManager::enabled)
+        .def_property_readonly("cost_to_cache", &rocksdb::WriteBufferManager::cost_to_cache)
+        .def_property("buffer_size", &rocksdb::WriteBufferManager::buffer_size,
+                      &rocksdb::WriteBufferManager::SetBufferSize)
+        .def_property_readonly("memory_usage", &rocksdb::WriteBufferManager::memory_usage)
+        .def_property_readonly("mutable_memtable_memory_usage",
+                               &rocksdb::WriteBufferManager::mutable_memtable_memory_usage)
+        .def("to_dict", [](const rocksdb::WriteBufferManager &instance) {
+            return py::dict("buffer_size"_a = instance.buffer_size(), "memory_usage"_a = instance.memory_usage(),
+                            "mutable_memtable_memory_usage"_a = instance.mutable_memtable_memory_usage(),
+                            "cost_to_cache"_a = instance.cost_to_cache());
+        });
+
+    // RocksDB SstFileManager aka rocksdb::SstFileManager, tracks the SST files of the databases sharing it, caps
+    // their total size and rate limits file deletions
+    py::class_<rocksdb::SstFileManager, std::shared_ptr<rocksdb::SstFileManager>>(m, "SstFileManager")
+        .def_static(
+            "NewSstFileManager",
+            [](int64_t rate_bytes_per_sec, double max_trash_db_ratio) {
+                status s;
+                std::shared_ptr<rocksdb::SstFileManager> manager(rocksdb::NewSstFileManager(
+                    rocksdb::Env::Default(), nullptr, "", rate_bytes_per_sec, true, &s, max_trash_db_ratio));
+                if (!s.ok()) {
+                    throw std::runtime_error(s.ToString());
+                }
+                return manager;
+            },
+            py::arg("rate_bytes_per_sec") = 0, py::arg("max_trash_db_ratio") = 0.25)
+        .def("SetMaxAllowedSpaceUsage", &rocksdb::SstFileManager::SetMaxAllowedSpaceUsage,
+             py::arg("max_allowed_space"))
+        .def("SetCompactionBufferSize", &rocksdb::SstFileManager::SetCompactionBufferSize,
+             py::arg("compaction_buffer_size"))
+        .def_property_readonly("is_max_allowed_space_reached", &rocksdb::SstFileManager::IsMaxAllowedSpaceReached)
+        .def_property_readonly("total_size", &rocksdb::SstFileManager::GetTotalSize)
+        .def_property_readonly("total_trash_size", &rocksdb::SstFileManager::GetTotalTrashSize)
+        .def_property("delete_rate_bytes_per_second", &rocksdb::SstFileManager::GetDeleteRateBytesPerSecond,
+                      &rocksdb::SstFileManager::SetDeleteRateBytesPerSecond)
+        .def("to_dict", [](rocksdb::SstFileManager &instance) {
+            return py::dict("total_size"_a = instance.GetTotalSize(),
+                            "total_trash_size"_a = instance.GetTotalTrashSize(),
+                            "is_max_allowed_space_reached"_a = instance.IsMaxAllowedSpaceReached(),
+                            "delete_rate_bytes_per_second"_a = instance.GetDeleteRateBytesPerSecond());
+        });
+
+    // RocksDB FilterPolicy aka rocksdb::FilterPolicy
+    py::class_<rocksdb::FilterPolicy, std::shared_ptr<rocksdb::FilterPolicy>>(m, "FilterPolicy")
+        .def_property_readonly("name", &rocksdb::FilterPolicy::Name)
+        .def_static(
+            "NewBloomFilterPolicy",
+            [](double bits_per_key) {
+                return std::shared_ptr<rocksdb::FilterPolicy>(
+                    const_cast<rocksdb::FilterPolicy *>(rocksdb::NewBloomFilterPolicy(bits_per_key)));
+            },
+            py::arg("bits_per_key") = 10.0)
+        .def_static(
+            "NewRibbonFilterPolicy",
+            [](double bloom_equivalent_bits_per_key, int bloom_before_level) {
+                return std::shared_ptr<rocksdb::FilterPolicy>(const_cast<rocksdb::FilterPolicy *>(
+                    rocksdb::NewRibbonFilterPolicy(bloom_equivalent_bits_per_key, bloom_before_level)));
+            },
+            py::arg("bloom_equivalent_bits_per_key") = 10.0, py::arg("bloom_before_level") = 0);
+
+    py::enum_<rocksdb::BlockBasedTableOptions::IndexType>(m, "IndexType")
+        .value("binary_search", rocksdb::BlockBasedTableOptions::kBinarySearch)
+        .value("hash_search", rocksdb::BlockBasedTableOptions::kHashSearch)
+        .value("two_level_index_search", rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch)
+        .value("binary_search_with_first_key", rocksdb::BlockBasedTableOptions::kBinarySearchWithFirstKey);
+
+    // RocksDB BlockBasedTableOptions aka rocksdb::BlockBasedTableOptions
+    py::class_<rocksdb::BlockBasedTableOptions>(m, "_BlockBasedTableOptions")
         .def(py::init())
+        .def_readwrite("block_cache", &rocksdb::BlockBasedTableOptions::block_cache)
+        .def_readwrite("no_block_cache", &rocksdb::BlockBasedTableOptions::no_block_cache)
+        .def_readwrite("block_size", &rocksdb::BlockBasedTableOptions::block_size)
+        .def_readwrite("block_size_deviation", &rocksdb::BlockBasedTableOptions::block_size_deviation)
+        .def_readwrite("block_restart_interval", &rocksdb::BlockBasedTableOptions::block_restart_interval)
+        .def_readwrite("metadata_block_size", &rocksdb::BlockBasedTableOptions::metadata_block_size)
+        .def_readwrite("index_type", &rocksdb::BlockBasedTableOptions::index_type)
+        .def_readwrite("partition_filters", &rocksdb::BlockBasedTableOptions::partition_filters)
+        .def_readwrite("whole_key_filtering", &rocksdb::BlockBasedTableOptions::whole_key_filtering)
+        .def_readwrite("optimize_filters_for_memory", &rocksdb::BlockBasedTableOptions::optimize_filters_for_memory)
+        .def_readwrite("cache_index_and_filter_blocks",
+                       &rocksdb::BlockBasedTableOptions::cache_index_and_filter_blocks)
+        .def_readwrite("cache_index_and_filter_blocks_with_high_priority",
+                       &rocksdb::BlockBasedTableOptions::cache_index_and_filter_blocks_with_high_priority)
+        .def_readwrite("pin_l0_filter_and_index_blocks_in_cache",
+                       &rocksdb::BlockBasedTableOptions::pin_l0_filter_and_index_blocks_in_cache)
+        .def_readwrite("pin_top_level_index_and_filter",
+                       &rocksdb::BlockBasedTableOptions::pin_top_level_index_and_filter)
+        .def_readwrite("format_version", &rocksdb::BlockBasedTableOptions::format_version)
+        .def_property(
+            "filter_policy",
+            [](const rocksdb::BlockBasedTableOptions &instance) {
+                return std::const_pointer_cast<rocksdb::FilterPolicy>(instance.filter_policy);
+            },
+            [](rocksdb::BlockBasedTableOptions &instance, std::shared_ptr<rocksdb::FilterPolicy> value) {
+                instance.filter_policy = value;
+            });
+
+    py::enum_<rocksdb::StatsLevel>(m, "StatsLevel")
+        .value("disable_all", rocksdb::StatsLevel::kDisableAll)
+        .value("except_tickers", rocksdb::StatsLevel::kExceptTickers)
+        .value("except_histogram_or_timers", rocksdb::StatsLevel::kExceptHistogramOrTimers)
+        .value("except_timers", rocksdb::StatsLevel::kExceptTimers)
+        .value("except_detailed_timers", rocksdb::StatsLevel::kExceptDetailedTimers)
+        .value("except_time_for_mutex", rocksdb::StatsLevel::kExceptTimeForMutex)
+        .value("all", rocksdb::StatsLevel::kAll);
+
+    // RocksDB Statistics aka rocksdb::Statistics, assign to `Options.statistics` before opening the database
+    py::class_<rocksdb::Statistics, std::shared_ptr<rocksdb::Statistics>>(m, "Statistics")
+        .def_static(
+            "CreateDBStatistics",
+            [](rocksdb::StatsLevel stats_level) {
+                std::shared_ptr<rocksdb::Statistics> statistics = rocksdb::CreateDBStatistics();
+                statistics->set_stats_level(stats_level);
+                return statistics;
+            },
+            py::arg("stats_level") = rocksdb::StatsLevel::kExceptDetailedTimers)
+        .def_property("stats_level", &rocksdb::Statistics::get_stats_level, &rocksdb::Statistics::set_stats_level)
+        .def(
+            "GetTickerCount",
+            [](const rocksdb::Statistics &instance, const std::string &name) -> std::optional<uint64_t> {
+                for (auto &[ticker, ticker_name] : rocksdb::TickersNameMap) {
+                    if (ticker_name == name) {
+                        return instance.getTickerCount(ticker);
+                    }
+                }
+                return std::nullopt;
+            },
+            py::arg("name"))
+        .def("Reset", &rocksdb::Statistics::Reset)
+        .def("to_dict", &StatisticsToDict)
+        .def("__str__", &rocksdb::Statistics::ToString);
+
+    py::enum_<rocksdb::PerfLevel>(m, "PerfLevel")
+        .value("disable", rocksdb::PerfLevel::kDisable)
+        .value("enable_count", rocksdb::PerfLevel::kEnableCount)
+        .value("enable_time_except_for_mutex", rocksdb::PerfLevel::kEnableTimeExceptForMutex)
+        .value("enable_time_and_cpu_time_except_for_mutex", rocksdb::PerfLevel::kEnableTimeAndCPUTimeExceptForMutex)
+        .value("enable_time", rocksdb::PerfLevel::kEnableTime);
+
+    // Sums rocksdb::PerfContext and rocksdb::IOStatsContext of the requests made on the current thread
+    py::class_<PerfContext>(m, "PerfContext")
+        .def(py::init<rocksdb::PerfLevel>(), py::arg("level") = rocksdb::PerfLevel::kEnableTimeExceptForMutex)
+        .def_readwrite("level", &PerfContext::level)
+        .def("Run", &PerfContext::Run, py::arg("func"))
+        .def("Reset", &PerfContext::Reset)
+        .def("to_dict", &PerfContext::ToDict)
+        .def("__enter__",
+             [](PerfContext &instance) -> PerfContext & {
+                 instance.Begin();
+                 return instance;
+             },
+             py::return_value_policy::reference)
+        .def("__exit__", [](PerfContext &instance, py::args) { instance.End(); });
+
+    // RocksDB BackupInfo aka rocksdb::BackupInfo
+    py::class_<rocksdb::BackupInfo>(m, "BackupInfo")
+        .def_readonly("backup_id", &rocksdb::BackupInfo::backup_id)
+        .def_readonly("timestamp", &rocksdb::BackupInfo::timestamp)
+        .def_readonly("size", &rocksdb::BackupInfo::size)
+        .def_readonly("number_files", &rocksdb::BackupInfo::number_files)
+        .def_readonly("app_metadata", &rocksdb::BackupInfo::app_metadata)
+        .def("__repr__", [](const rocksdb::BackupInfo &instance) {
+            return "BackupInfo(" + std::to_string(instance.backup_id) + ", " + std::to_string(instance.size) +
+                   " bytes)";
+        });
+
+    py::class_<BackupResponse>(m, "BackupResponse")
+        .def_property_readonly("status", [](const BackupResponse &instance) { return CastStatus(instance.status); })
+        .def_readonly("backup_id", &BackupResponse::backup_id);
+
+    // RocksDB BackupEngine aka rocksdb::BackupEngine
+    py::class_<BackupEngine>(m, "BackupEngine")
+        .def(py::init<rocksdb::BackupEngineOptions &>(), py::arg("options"), release_gil())
+        .def("CreateNewBackup", &BackupEngine::CreateNewBackup, py::arg("db"), py::arg("flush_before_backup") = false,
+             py::arg("progress") = py::none(), py::return_value_policy::move, release_gil())
+        .def("GetBackupInfo", &BackupEngine::GetBackupInfo, release_gil())
+        .def("PurgeOldBackups", &BackupEngine::PurgeOldBackups, py::arg("num_backups_to_keep"),
+             py::return_value_policy::move, release_gil())
+        .def("DeleteBackup", &BackupEngine::DeleteBackup, py::arg("backup_id"), py::return_value_policy::move,
+             release_gil())
+        .def("VerifyBackup", &BackupEngine::VerifyBackup, py::arg("backup_id"), py::arg("verify_with_checksum") = false,
+             py::return_value_policy::move, release_gil())
+        .def("RestoreDBFromBackup", &BackupEngine::RestoreDBFromBackup, py::arg("backup_id"), py::arg("db_dir"),
+             py::arg("wal_dir"), py::arg("keep_log_files") = false, py::return_value_policy::move, release_gil())
+        .def("RestoreDBFromLatestBackup", &BackupEngine::RestoreDBFromLatestBackup, py::arg("db_dir"),
+             py::arg("wal_dir"), py::arg("keep_log_files") = false, py::return_value_policy::move, release_gil())
+        .def_property_readonly("bytes_copied_estimate", &BackupEngine::BytesCopiedEstimate)
+        .def("Close", &BackupEngine::Close, release_gil());
+
+    // RocksDB MergeOperator aka rocksdb::MergeOperator, native operators for `Options.merge_operator`
+    py::class_<rocksdb::MergeOperator, std::shared_ptr<rocksdb::MergeOperator>>(m, "MergeOperator")
+        .def_property_readonly("name", &rocksdb::MergeOperator::Name)
+        .def_static("UInt64Add", []() -> std::shared_ptr<rocksdb::MergeOperator> {
+            return std::make_shared<UInt64AddOperator>();
+        })
+        .def_static(
+            "StringAppend",
+            [](std::string &delimiter) -> std::shared_ptr<rocksdb::MergeOperator> {
+                return std::make_shared<StringAppendOperator>(delimiter);
+            },
+            py::arg("delimiter") = ",")
+        .def_static(
+            "BoundedListAppend",
+            [](size_t limit, std::string &delimiter) -> std::shared_ptr<rocksdb::MergeOperator> {
+                return std::make_shared<BoundedListAppendOperator>(limit, delimiter);
+            },
+            py::arg("limit"), py::arg("delimiter") = ",")
+        .def_static("Max", []() -> std::shared_ptr<rocksdb::MergeOperator> {
+            return std::make_shared<CompareOperator>(true);
+        })
+        .def_static("Min", []() -> std::shared_ptr<rocksdb::MergeOperator> {
+            return std::make_shared<CompareOperator>(false);
+        })
+        .def_static("PutIfAbsent", []() -> std::shared_ptr<rocksdb::MergeOperator> {
+            return std::make_shared<PutIfAbsentOperator>();
+        })
+        .def_static(
+            "EncodeUInt64", [](uint64_t value) { return py::bytes(UInt64AddOperator::Encode(value)); },
+            py::arg("value"))
+        .def_static(
+            "DecodeUInt64",
+            [](rocksdb::Slice value) {
+                uint64_t decoded;
+                if (!UInt64AddOperator::Decode(value, &decoded)) {
+                    throw std::invalid_argument("value must be 8 bytes");
+                }
+                return decoded;
+            },
+            py::arg("value"))
+        .def("__repr__", [](const rocksdb::MergeOperator &instance) {
+            return "MergeOperator('" + std::string(instance.Name()) + "')";
+        });
+
+    // RocksDB CompactionFilterFactory aka rocksdb::CompactionFilterFactory
+    py::class_<rocksdb::CompactionFilterFactory, std::shared_ptr<rocksdb::CompactionFilterFactory>>(
+        m, "CompactionFilterFactory")
+        .def_property_readonly("name", &rocksdb::CompactionFilterFactory::Name);
+
+    py::class_<PrefixDropFilterFactory, rocksdb::CompactionFilterFactory, std::shared_ptr<PrefixDropFilterFactory>>(
+        m, "PrefixDropFilter")
+        .def(py::init<std::vector<std::string>>(), py::arg("prefixes") = std::vector<std::string>())
+        .def_property_readonly("prefixes", &PrefixDropFilterFactory::Prefixes)
+        .def("Add", &PrefixDropFilterFactory::Add, py::arg("prefix"))
+        .def("Remove", &PrefixDropFilterFactory::Remove, py::arg("prefix"));
+
+    py::enum_<rocksdb::BottommostLevelCompaction>(m, "BottommostLevelCompaction")
+        .value("skip", rocksdb::BottommostLevelCompaction::kSkip)
+        .value("if_have_compaction_filter", rocksdb::BottommostLevelCompaction::kIfHaveCompactionFilter)
+        .value("force", rocksdb::BottommostLevelCompaction::kForce)
+        .value("force_optimized", rocksdb::BottommostLevelCompaction::kForceOptimized);
+
+    py::enum_<rocksdb::CompactionStyle>(m, "CompactionStyle")
+        .value("level", rocksdb::kCompactionStyleLevel)
+        .value("universal", rocksdb::kCompactionStyleUniversal)
+        .value("fifo", rocksdb::kCompactionStyleFIFO)
+        .value("none", rocksdb::kCompactionStyleNone);
+
+    py::enum_<rocksdb::CompressionType>(m, "CompressionType")
+        .value("no_compression", rocksdb::kNoCompression)
+        .value("snappy", rocksdb::kSnappyCompression)
+        .value("zlib", rocksdb::kZlibCompression)
+        .value("bzip2", rocksdb::kBZip2Compression)
+        .value("lz4", rocksdb::kLZ4Compression)
+        .value("lz4hc", rocksdb::kLZ4HCCompression)
+        .value("xpress", rocksdb::kXpressCompression)
+        .value("zstd", rocksdb::kZSTD)
+        .value("disable", rocksdb::kDisableCompressionOption);
+
+    // Whether flushes also insert the new blobs into `blob_cache`
+    py::enum_<rocksdb::PrepopulateBlobCache>(m, "PrepopulateBlobCache")
+        .value("disable", rocksdb::PrepopulateBlobCache::kDisable)
+        .value("flush_only", rocksdb::PrepopulateBlobCache::kFlushOnly);
+
+    // RocksDB SliceTransform aka rocksdb::SliceTransform, used as prefix extractor
+    py::class_<rocksdb::SliceTransform, std::shared_ptr<rocksdb::SliceTransform>>(m, "SliceTransform")
+        .def_property_readonly("name", &rocksdb::SliceTransform::Name)
+        .def_static(
+            "NewFixedPrefixTransform",
+            [](size_t prefix_len) {
+                return std::shared_ptr<rocksdb::SliceTransform>(
+                    const_cast<rocksdb::SliceTransform *>(rocksdb::NewFixedPrefixTransform(prefix_len)));
+            },
+            py::arg("prefix_len"))
+        .def_static(
+            "NewCappedPrefixTransform",
+            [](size_t cap_len) {
+                return std::shared_ptr<rocksdb::SliceTransform>(
+                    const_cast<rocksdb::SliceTransform *>(rocksdb::NewCappedPrefixTransform(cap_len)));
+            },
+            py::arg("cap_len"))
+        .def_static("NewNoopTransform", []() {
+            return std::shared_ptr<rocksdb::SliceTransform>(
+                const_cast<rocksdb::SliceTransform *>(rocksdb::NewNoopTransform()));
+        });
+
+    // RocksDB column family options aka rocksdb::ColumnFamilyOptions
+    py::class_<rocksdb::ColumnFamilyOptions> column_family_options(m, "_ColumnFamilyOptions");
+    column_family_options.def(py::init())
+        .def_readwrite("write_buffer_size", &rocksdb::ColumnFamilyOptions::write_buffer_size)
+        .def_readwrite("level0_file_num_compaction_trigger",
+                       &rocksdb::ColumnFamilyOptions::level0_file_num_compaction_trigger)
+        .def_readwrite("max_bytes_for_level_base", &rocksdb::ColumnFamilyOptions::max_bytes_for_level_base)
+        .def_readwrite("disable_auto_compactions", &rocksdb::ColumnFamilyOptions::disable_auto_compactions);
+    BindColumnFamilyOptions(column_family_options);
+
+    // RocksDB options aka rocksdb::Options
+    py::class_<rocksdb::Options> options(m, "_Options");
+    BindColumnFamilyOptions(options);
+    options.def(py::init())
         .def_readwrite("write_buffer_size", &rocksdb::Options::write_buffer_size)
         .def_readwrite("level0_file_num_compaction_trigger", &rocksdb::Options::level0_file_num_compaction_trigger)
         .def_readwrite("max_bytes_for_level_base", &rocksdb::Options::max_bytes_for_level_base)
@@ -71,6 +901,10 @@ PYBIND11_MODULE(rocksdb_ext, m) {
                        &rocksdb::Options::use_direct_io_for_flush_and_compaction)
         .def_readwrite("allow_fallocate", &rocksdb::Options::allow_fallocate)
         .def_readwrite("is_fd_close_on_exec", &rocksdb::Options::is_fd_close_on_exec)
+        .def_readwrite("statistics", &rocksdb::Options::statistics)
+        .def_readwrite("rate_limiter", &rocksdb::Options::rate_limiter)
+        .def_readwrite("write_buffer_manager", &rocksdb::Options::write_buffer_manager)
+        .def_readwrite("sst_file_manager", &rocksdb::Options::sst_file_manager)
         .def_readwrite("stats_dump_period_sec", &rocksdb::Options::stats_dump_period_sec)
         .def_readwrite("stats_persist_period_sec", &rocksdb::Options::stats_persist_period_sec)
         .def_readwrite("persist_stats_to_disk", &rocksdb::Options::persist_stats_to_disk)
@@ -240,6 +1074,14 @@ PYBIND11_MODULE(rocksdb_ext, m) {
     // RocksDB ReadOptions aka rocksdb::ReadOptions
     py::class_<rocksdb::ReadOptions, std::shared_ptr<rocksdb::ReadOptions>>(m, "_ReadOptions")
         .def(py::init())
+        // The python `ReadOptions.snapshot` attribute keeps only the current snapshot alive, a read with a snapshot
+        // released since fails in CHECK_SNAPSHOT
+        .def(
+            "_SetSnapshot",
+            [](rocksdb::ReadOptions &instance, Snapshot *snapshot) {
+                instance.snapshot = snapshot == nullptr ? nullptr : snapshot->Get();
+            },
+            py::arg("snapshot"))
         .def_readwrite("readahead_size", &rocksdb::ReadOptions::readahead_size)
         .def_readwrite("max_skippable_internal_keys", &rocksdb::ReadOptions::max_skippable_internal_keys)
         .def_readwrite("verify_checksums", &rocksdb::ReadOptions::verify_checksums)
@@ -255,7 +1097,11 @@ PYBIND11_MODULE(rocksdb_ext, m) {
         .def_readwrite("value_size_soft_limit", &rocksdb::ReadOptions::value_size_soft_limit)
         .def_readwrite("adaptive_readahead", &rocksdb::ReadOptions::adaptive_readahead)
         .def_readwrite("async_io", &rocksdb::ReadOptions::async_io)
-        .def_readwrite("optimize_multiget_for_io", &rocksdb::ReadOptions::optimize_multiget_for_io);
+        .def_readwrite("optimize_multiget_for_io", &rocksdb::ReadOptions::optimize_multiget_for_io)
+#if ROCKSDB_MAJOR > 8 || (ROCKSDB_MAJOR == 8 && ROCKSDB_MINOR >= 7)
+        .def_readwrite("auto_readahead_size", &rocksdb::ReadOptions::auto_readahead_size)
+#endif
+        ;
 
     // RocksDB WriteOptions aka rocksdb::WriteOptions
     py::class_<rocksdb::WriteOptions, std::shared_ptr<rocksdb::WriteOptions>>(m, "_WriteOptions")
@@ -268,9 +1114,78 @@ PYBIND11_MODULE(rocksdb_ext, m) {
         .def_readwrite("memtable_insert_hint_per_batch", &rocksdb::WriteOptions::memtable_insert_hint_per_batch)
         .def_readwrite("protection_bytes_per_key", &rocksdb::WriteOptions::protection_bytes_per_key);
 
-    // RocksDB FlushOptions aka rocksdb::ReadOptions
+    // RocksDB BackupEngineOptions aka rocksdb::BackupEngineOptions
+    py::class_<rocksdb::BackupEngineOptions>(m, "_BackupEngineOptions")
+        .def(py::init<const std::string &>(), py::arg("backup_dir"))
+        .def_readwrite("backup_dir", &rocksdb::BackupEngineOptions::backup_dir)
+        .def_readwrite("share_table_files", &rocksdb::BackupEngineOptions::share_table_files)
+        .def_readwrite("share_files_with_checksum", &rocksdb::BackupEngineOptions::share_files_with_checksum)
+        .def_readwrite("sync", &rocksdb::BackupEngineOptions::sync)
+        .def_readwrite("destroy_old_data", &rocksdb::BackupEngineOptions::destroy_old_data)
+        .def_readwrite("backup_log_files", &rocksdb::BackupEngineOptions::backup_log_files)
+        .def_readwrite("backup_rate_limit", &rocksdb::BackupEngineOptions::backup_rate_limit)
+        .def_readwrite("restore_rate_limit", &rocksdb::BackupEngineOptions::restore_rate_limit)
+        .def_readwrite("max_background_operations", &rocksdb::BackupEngineOptions::max_background_operations)
+        .def_readwrite("callback_trigger_interval_size",
+                       &rocksdb::BackupEngineOptions::callback_trigger_interval_size);
+
+    // RocksDB TransactionDBOptions aka rocksdb::TransactionDBOptions, timeouts are in milliseconds (negative waits
+    // forever)
+    py::class_<rocksdb::TransactionDBOptions>(m, "_TransactionDBOptions")
+        .def(py::init())
+        .def_readwrite("max_num_locks", &rocksdb::TransactionDBOptions::max_num_locks)
+        .def_readwrite("max_num_deadlocks", &rocksdb::TransactionDBOptions::max_num_deadlocks)
+        .def_readwrite("num_stripes", &rocksdb::TransactionDBOptions::num_stripes)
+        .def_readwrite("transaction_lock_timeout", &rocksdb::TransactionDBOptions::transaction_lock_timeout)
+        .def_readwrite("default_lock_timeout", &rocksdb::TransactionDBOptions::default_lock_timeout);
+
+    // RocksDB TransactionOptions aka rocksdb::TransactionOptions, optimistic transactions only use `set_snapshot`
+    py::class_<rocksdb::TransactionOptions>(m, "_TransactionOptions")
+        .def(py::init())
+        .def_readwrite("set_snapshot", &rocksdb::TransactionOptions::set_snapshot)
+        .def_readwrite("deadlock_detect", &rocksdb::TransactionOptions::deadlock_detect)
+        .def_readwrite("deadlock_detect_depth", &rocksdb::TransactionOptions::deadlock_detect_depth)
+        .def_readwrite("lock_timeout", &rocksdb::TransactionOptions::lock_timeout)
+        .def_readwrite("expiration", &rocksdb::TransactionOptions::expiration)
+        .def_readwrite("max_write_batch_size", &rocksdb::TransactionOptions::max_write_batch_size)
+        .def_readwrite("skip_concurrency_control", &rocksdb::TransactionOptions::skip_concurrency_control);
+
+    // RocksDB CompactRangeOptions aka rocksdb::CompactRangeOptions
+    py::class_<rocksdb::CompactRangeOptions>(m, "_CompactRangeOptions")
+        .def(py::init())
+        .def_readwrite("exclusive_manual_compaction", &rocksdb::CompactRangeOptions::exclusive_manual_compaction)
+        .def_readwrite("change_level", &rocksdb::CompactRangeOptions::change_level)
+        .def_readwrite("target_level", &rocksdb::CompactRangeOptions::target_level)
+        .def_readwrite("target_path_id", &rocksdb::CompactRangeOptions::target_path_id)
+        .def_readwrite("bottommost_level_compaction", &rocksdb::CompactRangeOptions::bottommost_level_compaction)
+        .def_readwrite("allow_write_stall", &rocksdb::CompactRangeOptions::allow_write_stall)
+        .def_readwrite("max_subcompactions", &rocksdb::CompactRangeOptions::max_subcompactions);
+
+    // RocksDB CompactionOptions aka rocksdb::CompactionOptions
+    py::class_<rocksdb::CompactionOptions>(m, "_CompactionOptions")
+        .def(py::init())
+        .def_readwrite("compression", &rocksdb::CompactionOptions::compression)
+        .def_readwrite("output_file_size_limit", &rocksdb::CompactionOptions::output_file_size_limit)
+        .def_readwrite("max_subcompactions", &rocksdb::CompactionOptions::max_subcompactions);
+
+    // RocksDB FlushOptions aka rocksdb::FlushOptions
     py::class_<rocksdb::FlushOptions, std::shared_ptr<rocksdb::FlushOptions>>(m, "_FlushOptions")
         .def(py::init())
         .def_readwrite("wait", &rocksdb::FlushOptions::wait)
         .def_readwrite("allow_write_stall", &rocksdb::FlushOptions::allow_write_stall);
+
+    // RocksDB IngestExternalFileOptions aka rocksdb::IngestExternalFileOptions
+    py::class_<rocksdb::IngestExternalFileOptions>(m, "_IngestExternalFileOptions")
+        .def(py::init())
+        .def_readwrite("move_files", &rocksdb::IngestExternalFileOptions::move_files)
+        .def_readwrite("failed_move_fall_back_to_copy",
+                       &rocksdb::IngestExternalFileOptions::failed_move_fall_back_to_copy)
+        .def_readwrite("snapshot_consistency", &rocksdb::IngestExternalFileOptions::snapshot_consistency)
+        .def_readwrite("allow_global_seqno", &rocksdb::IngestExternalFileOptions::allow_global_seqno)
+        .def_readwrite("allow_blocking_flush", &rocksdb::IngestExternalFileOptions::allow_blocking_flush)
+        .def_readwrite("ingest_behind", &rocksdb::IngestExternalFileOptions::ingest_behind)
+        .def_readwrite("write_global_seqno", &rocksdb::IngestExternalFileOptions::write_global_seqno)
+        .def_readwrite("verify_checksums_before_ingest",
+                       &rocksdb::IngestExternalFileOptions::verify_checksums_before_ingest)
+        .def_readwrite("verify_file_checksum", &rocksdb::IngestExternalFileOptions::verify_file_checksum);
 }
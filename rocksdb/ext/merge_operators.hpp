@@ -0,0 +1,172 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+#include <rocksdb/merge_operator.h>
+
+// Associative operators get partial merge for free, compactions fold consecutive operands into one.
+// Each operator keeps its name stable since it is recorded in the OPTIONS file of the database
+
+// Counters stored as 8-byte little-endian unsigned integers. A value of any other size fails the merge, so
+// reads of the key return Corruption instead of silently restarting the counter from 0
+class UInt64AddOperator : public rocksdb::AssociativeMergeOperator {
+   public:
+    static std::string Encode(uint64_t value) {
+        std::string encoded(sizeof(uint64_t), '\0');
+        for (size_t i = 0; i < sizeof(uint64_t); i++) {
+            encoded[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+        }
+
+        return encoded;
+    }
+
+    static bool Decode(const rocksdb::Slice &value, uint64_t *decoded) {
+        if (value.size() != sizeof(uint64_t)) {
+            return false;
+        }
+
+        *decoded = 0;
+        for (size_t i = 0; i < sizeof(uint64_t); i++) {
+            *decoded |= static_cast<uint64_t>(static_cast<unsigned char>(value[i])) << (i * 8);
+        }
+
+        return true;
+    }
+
+    bool Merge(const rocksdb::Slice &key, const rocksdb::Slice *existing_value, const rocksdb::Slice &value,
+               std::string *new_value, rocksdb::Logger *logger) const override {
+        uint64_t existing = 0, operand;
+        if ((existing_value != nullptr && !Decode(*existing_value, &existing)) || !Decode(value, &operand)) {
+            rocksdb::Log(rocksdb::InfoLogLevel::ERROR_LEVEL, logger,
+                         "UInt64AddOperator: value of key %s is not an 8-byte integer", key.ToString(true).c_str());
+            return false;
+        }
+
+        *new_value = Encode(existing + operand);
+        return true;
+    }
+
+    const char *Name() const override {
+        return "UInt64AddOperator";
+    }
+};
+
+class StringAppendOperator : public rocksdb::AssociativeMergeOperator {
+   public:
+    StringAppendOperator(std::string delimiter) : delimiter(std::move(delimiter)) {}
+
+    bool Merge(const rocksdb::Slice &, const rocksdb::Slice *existing_value, const rocksdb::Slice &value,
+               std::string *new_value, rocksdb::Logger *) const override {
+        if (existing_value == nullptr) {
+            new_value->assign(value.data(), value.size());
+        } else {
+            new_value->reserve(existing_value->size() + this->delimiter.size() + value.size());
+            new_value->assign(existing_value->data(), existing_value->size());
+            new_value->append(this->delimiter);
+            new_value->append(value.data(), value.size());
+        }
+
+        return true;
+    }
+
+    const char *Name() const override {
+        return "StringAppendOperator";
+    }
+
+   private:
+    std::string delimiter;
+};
+
+// Keeps only the last `limit` items of a `delimiter` separated list
+class BoundedListAppendOperator : public rocksdb::AssociativeMergeOperator {
+   public:
+    BoundedListAppendOperator(size_t limit, std::string delimiter) : limit(limit), delimiter(std::move(delimiter)) {
+        if (limit == 0) {
+            throw std::invalid_argument("limit must be greater than 0");
+        } else if (this->delimiter.empty()) {
+            throw std::invalid_argument("delimiter must be non-empty");
+        }
+    }
+
+    bool Merge(const rocksdb::Slice &, const rocksdb::Slice *existing_value, const rocksdb::Slice &value,
+               std::string *new_value, rocksdb::Logger *) const override {
+        std::string list;
+        if (existing_value == nullptr) {
+            list.assign(value.data(), value.size());
+        } else {
+            list.reserve(existing_value->size() + this->delimiter.size() + value.size());
+            list.assign(existing_value->data(), existing_value->size());
+            list.append(this->delimiter);
+            list.append(value.data(), value.size());
+        }
+
+        // Walk back over `limit` delimiters, everything before the last one found is dropped
+        size_t end = list.size();
+        size_t items = 1;
+        while (end > 0) {
+            size_t position = list.rfind(this->delimiter, end - 1);
+            if (position == std::string::npos) {
+                break;
+            } else if (items == this->limit) {
+                list.erase(0, position + this->delimiter.size());
+                break;
+            }
+
+            items++;
+            end = position;
+        }
+
+        *new_value = std::move(list);
+        return true;
+    }
+
+    const char *Name() const override {
+        return "BoundedListAppendOperator";
+    }
+
+   private:
+    size_t limit;
+    std::string delimiter;
+};
+
+// Keeps the bytewise greatest (or smallest) value, store numbers big-endian to compare them by value
+class CompareOperator : public rocksdb::AssociativeMergeOperator {
+   public:
+    CompareOperator(bool max) : max(max) {}
+
+    bool Merge(const rocksdb::Slice &, const rocksdb::Slice *existing_value, const rocksdb::Slice &value,
+               std::string *new_value, rocksdb::Logger *) const override {
+        const rocksdb::Slice *result = &value;
+        if (existing_value != nullptr) {
+            int comparison = existing_value->compare(value);
+            if (this->max ? comparison >= 0 : comparison <= 0) {
+                result = existing_value;
+            }
+        }
+
+        new_value->assign(result->data(), result->size());
+        return true;
+    }
+
+    const char *Name() const override {
+        return this->max ? "MaxOperator" : "MinOperator";
+    }
+
+   private:
+    bool max;
+};
+
+// The first value written wins, later operands are ignored
+class PutIfAbsentOperator : public rocksdb::AssociativeMergeOperator {
+   public:
+    bool Merge(const rocksdb::Slice &, const rocksdb::Slice *existing_value, const rocksdb::Slice &value,
+               std::string *new_value, rocksdb::Logger *) const override {
+        const rocksdb::Slice *result = existing_value != nullptr ? existing_value : &value;
+        new_value->assign(result->data(), result->size());
+        return true;
+    }
+
+    const char *Name() const override {
+        return "PutIfAbsentOperator";
+    }
+};
@@ -1,48 +1,275 @@
 #pragma once
 
+#include "catch_up.hpp"
+
+#include <algorithm>
 #include <exception>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <rocksdb/cache.h>
 #include <rocksdb/db.h>
+#include <rocksdb/experimental.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/rate_limiter.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/sst_file_manager.h>
+#include <rocksdb/table.h>
+#include <rocksdb/utilities/checkpoint.h>
+#include <rocksdb/utilities/optimistic_transaction_db.h>
+#include <rocksdb/utilities/transaction_db.h>
+#include <rocksdb/utilities/write_batch_with_index.h>
+#include <rocksdb/version.h>
+#if ROCKSDB_MAJOR >= 8
+#include <rocksdb/wide_columns.h>
+#endif
+#include <rocksdb/write_batch.h>
+#include <rocksdb/write_buffer_manager.h>
+
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <unordered_set>
 
 namespace py = pybind11;
 using status = rocksdb::Status;
+using release_gil = py::call_guard<py::gil_scoped_release>;
+
+// Binary-safe string, converted to python `bytes` instead of `str`
+struct Binary : std::string {
+    Binary() = default;
+    Binary(std::string &&value) : std::string(std::move(value)) {}
+};
+
+namespace pybind11::detail {
+// Borrow keys and values from `str` and `bytes` without copying them, the python object is kept alive by the
+// caller until the call returns. Other buffers (bytearray, memoryview, ...) are mutable and may be written or
+// resized by another thread once the GIL is released, so they are copied while the GIL is still held
+template <>
+struct type_caster<rocksdb::Slice> {
+   public:
+    PYBIND11_TYPE_CASTER(rocksdb::Slice, const_name("Union[str, bytes, bytearray, memoryview]"));
+
+    type_caster() = default;
+    type_caster(type_caster &&other) noexcept : value(other.value), copy(std::move(other.copy)) {}
+    type_caster(const type_caster &) = delete;
+
+    bool load(handle src, bool) {
+        PyObject *obj = src.ptr();
+
+        if (PyUnicode_Check(obj)) {
+            Py_ssize_t size;
+            const char *data = PyUnicode_AsUTF8AndSize(obj, &size);
+            if (data == nullptr) {
+                PyErr_Clear();
+                return false;
+            }
+            value = rocksdb::Slice(data, size);
+            return true;
+        } else if (PyBytes_Check(obj)) {
+            value = rocksdb::Slice(PyBytes_AS_STRING(obj), PyBytes_GET_SIZE(obj));
+            return true;
+        } else if (PyObject_CheckBuffer(obj)) {
+            Py_buffer view;
+            if (PyObject_GetBuffer(obj, &view, PyBUF_SIMPLE) != 0) {
+                PyErr_Clear();
+                return false;
+            }
+            // Heap allocated so `value` stays valid when the caster is moved
+            this->copy = std::make_unique<std::string>(static_cast<const char *>(view.buf), view.len);
+            PyBuffer_Release(&view);
+            value = rocksdb::Slice(*this->copy);
+            return true;
+        }
+
+        return false;
+    }
+
+    static handle cast(const rocksdb::Slice &src, return_value_policy, handle) {
+        return PyBytes_FromStringAndSize(src.data(), src.size());
+    }
+
+   private:
+    std::unique_ptr<std::string> copy;
+};
+
+template <>
+struct type_caster<Binary> {
+   public:
+    PYBIND11_TYPE_CASTER(Binary, const_name("bytes"));
+
+    bool load(handle, bool) {
+        return false;
+    }
+
+    static handle cast(const Binary &src, return_value_policy, handle) {
+        return PyBytes_FromStringAndSize(src.data(), src.size());
+    }
+};
+}  // namespace pybind11::detail
+
+// Value pinned in the block cache (or memtable copy) and exposed to python through the buffer protocol.
+// The pin is released when the python object is collected
+class Value {
+   public:
+    rocksdb::PinnableSlice slice;
+
+    Value() = default;
+
+    Value(rocksdb::PinnableSlice &&slice) : slice(std::move(slice)) {}
+
+    Value(std::string &&value) {
+        this->slice.GetSelf()->swap(value);
+        this->slice.PinSelf();
+    }
+
+    Value(const Value &) = delete;
+    Value &operator=(const Value &) = delete;
+};
+
+// OK and NotFound are returned by almost every data op, so they share one python object each
+inline py::object CastStatus(const rocksdb::Status &s) {
+    static auto *ok = new py::object(py::cast(status::OK()));
+    static auto *not_found = new py::object(py::cast(status::NotFound()));
+
+    if (s.ok()) {
+        return *ok;
+    } else if (s.IsNotFound() && s.subcode() == status::kNone && s.getState() == nullptr) {
+        return *not_found;
+    }
+
+    return py::cast(s);
+}
 
 class Response {
    public:
     rocksdb::Status status;
-    std::string value;
-    rocksdb::Options options;
+    std::shared_ptr<Value> value;
 
-    Response(rocksdb::Status &s, std::string *value = nullptr, rocksdb::Options *options = nullptr) {
-        if (value != nullptr) {
-            this->value = *value;
-        }
-        if (options != nullptr) {
-            this->options = *options;
+    Response(rocksdb::Status s, std::shared_ptr<Value> value = nullptr) : status(std::move(s)) {
+        if (this->status.ok()) {
+            this->value = std::move(value);
         }
-
-        this->status = s;
     }
 };
 
+class OptionsResponse {
+   public:
+    rocksdb::Status status;
+    rocksdb::Options options;
+
+    OptionsResponse(rocksdb::Status s, rocksdb::Options options) : status(std::move(s)), options(std::move(options)) {}
+};
+
+class PropertiesResponse {
+   public:
+    rocksdb::Status status;
+    std::map<std::string, std::string> properties;
+
+    PropertiesResponse(rocksdb::Status s, std::map<std::string, std::string> properties = {})
+        : status(std::move(s)), properties(std::move(properties)) {}
+};
+
+class EntityResponse {
+   public:
+    rocksdb::Status status;
+    // Sorted by name
+    std::vector<std::pair<Binary, Binary>> columns;
+
+    EntityResponse(rocksdb::Status s, std::vector<std::pair<Binary, Binary>> columns = {})
+        : status(std::move(s)), columns(std::move(columns)) {}
+};
+
+class MultiResponse {
+   public:
+    std::vector<rocksdb::Status> statuses;
+    std::vector<std::shared_ptr<Value>> values;
+
+    MultiResponse(size_t size) : statuses(size), values(size) {}
+};
+
+// Column family handle, invalidated when the column family is dropped or the database is closed
+class ColumnFamily {
+   public:
+    std::string name;
+    rocksdb::ColumnFamilyHandle *handle;
+
+    ColumnFamily(rocksdb::ColumnFamilyHandle *handle) : name(handle->GetName()), handle(handle) {}
+};
+
+// Write batches resolve `nullptr` to the default column family
+inline rocksdb::ColumnFamilyHandle *BatchHandle(ColumnFamily *column_family) {
+    if (column_family == nullptr) {
+        return nullptr;
+    } else if (column_family->handle == nullptr) {
+        throw std::runtime_error("Cannot invoke request column family '" + column_family->name + "' dropped");
+    }
+
+    return column_family->handle;
+}
+
+// How RocksDB opens the database, Transaction objects need one of the transaction types
+enum class TransactionDBType { kNone, kPessimistic, kOptimistic };
+
+class Iterator;
+class Snapshot;
+class Transaction;
+
 class RocksDB {
    public:
     rocksdb::DB *db;
     bool is_running = false;
     bool read_only = false;
 
+    // Column families missing from `column_families` but present on disk are opened with `op`.
+    // `transaction_db_options` is only used by TransactionDBType::kPessimistic
     RocksDB(const std::string db_path, rocksdb::Options &op, bool read_only = false,
-            std::string *secondary_path = nullptr) {
+            std::string *secondary_path = nullptr,
+            std::map<std::string, rocksdb::ColumnFamilyOptions> column_families = {},
+            TransactionDBType transaction_db = TransactionDBType::kNone,
+            rocksdb::TransactionDBOptions *transaction_db_options = nullptr) {
         status s;
 
-        if (read_only == false) {
-            s = rocksdb::DB::Open(op, db_path, &this->db);
+        if (read_only && transaction_db != TransactionDBType::kNone) {
+            throw std::invalid_argument("Secondary instances cannot be opened as TransactionDB");
+        }
+
+        std::vector<std::string> names;
+        if (!rocksdb::DB::ListColumnFamilies(op, db_path, &names).ok()) {
+            names = {rocksdb::kDefaultColumnFamilyName};
+        }
+        for (auto &item : column_families) {
+            if (std::find(names.begin(), names.end(), item.first) == names.end()) {
+                names.push_back(item.first);
+            }
+        }
+
+        std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+        for (auto &name : names) {
+            auto item = column_families.find(name);
+            descriptors.emplace_back(name, item != column_families.end() ? item->second
+                                                                          : rocksdb::ColumnFamilyOptions(op));
+        }
+
+        std::vector<rocksdb::ColumnFamilyHandle *> handles;
+
+        if (read_only == false && transaction_db == TransactionDBType::kPessimistic) {
+            s = rocksdb::TransactionDB::Open(
+                op, transaction_db_options != nullptr ? *transaction_db_options : rocksdb::TransactionDBOptions(),
+                db_path, descriptors, &handles, &this->transaction_db);
+            this->db = this->transaction_db;
+        } else if (read_only == false && transaction_db == TransactionDBType::kOptimistic) {
+            s = rocksdb::OptimisticTransactionDB::Open(op, db_path, descriptors, &handles,
+                                                       &this->optimistic_transaction_db);
+            this->db = this->optimistic_transaction_db;
+        } else if (read_only == false) {
+            s = rocksdb::DB::Open(op, db_path, descriptors, &handles, &this->db);
         } else if (read_only == true) {
             if (secondary_path == nullptr) {
                 throw std::invalid_argument("secondary_path must be non-empty");
             } else {
-                s = rocksdb::DB::OpenAsSecondary(op, db_path, *secondary_path, &this->db);
+                s = rocksdb::DB::OpenAsSecondary(op, db_path, *secondary_path, descriptors, &handles, &this->db);
             }
 
         } else {
@@ -53,26 +280,155 @@ class RocksDB {
             throw std::runtime_error(s.getState());
         }
 
+        for (auto *handle : handles) {
+            this->column_families[handle->GetName()] = std::make_shared<ColumnFamily>(handle);
+        }
+
         this->is_running = true;
         this->read_only = read_only;
+        this->db_path = db_path;
+    }
+
+    std::shared_ptr<ColumnFamily> CreateColumnFamily(rocksdb::ColumnFamilyOptions &options, std::string &name) {
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        if (this->column_families.count(name)) {
+            throw std::invalid_argument("Column family '" + name + "' already exists");
+        }
+
+        rocksdb::ColumnFamilyHandle *handle;
+        status s = this->db->CreateColumnFamily(options, name, &handle);
+        if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+
+        auto column_family = std::make_shared<ColumnFamily>(handle);
+        this->column_families[name] = column_family;
+        return column_family;
     }
 
-    Response Get(rocksdb::ReadOptions &options, std::string &key) {
+    Response DropColumnFamily(ColumnFamily &column_family) {
+        // Wait for in-flight requests that may use the handle
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
         status s;
-        std::string value;
+
+        if (column_family.handle == nullptr) {
+            s = status::InvalidArgument("Column family '" + column_family.name + "' already dropped");
+        } else if (column_family.name == rocksdb::kDefaultColumnFamilyName) {
+            s = status::InvalidArgument("Cannot drop the default column family");
+        } else {
+            s = this->db->DropColumnFamily(column_family.handle);
+            if (s.ok()) {
+                this->db->DestroyColumnFamilyHandle(column_family.handle);
+                column_family.handle = nullptr;
+                this->column_families.erase(column_family.name);
+            }
+        }
+
+        return Response(s);
+    }
+
+    std::shared_ptr<ColumnFamily> GetColumnFamily(std::string &name) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        auto item = this->column_families.find(name);
+        if (item == this->column_families.end()) {
+            throw std::invalid_argument("Column family '" + name + "' not found");
+        }
+
+        return item->second;
+    }
+
+    std::vector<std::string> ListColumnFamilies() {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        std::vector<std::string> names;
+        for (auto &item : this->column_families) {
+            names.push_back(item.first);
+        }
+
+        return names;
+    }
+
+    static std::vector<std::string> ListColumnFamiliesOnDisk(rocksdb::Options &options, std::string &db_path) {
+        std::vector<std::string> names;
+        status s = rocksdb::DB::ListColumnFamilies(options, db_path, &names);
+        if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+
+        return names;
+    }
+
+    Response Get(rocksdb::ReadOptions &options, rocksdb::Slice key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+        auto snapshot_lock = CHECK_SNAPSHOT(options);
+
+        status s;
+        auto value = std::make_shared<Value>();
 
         if (key.empty()) {
             s = status::InvalidArgument("Key must be non-empty");
         } else {
-            s = this->db->Get(options, key, &value);
+            s = this->db->Get(options, HANDLE(column_family), key, &value->slice);
         }
 
-        return Response(s, &value);
+        return Response(s, value);
     }
 
-    Response Put(rocksdb::WriteOptions &options, std::string &key, std::string &value) {
+    MultiResponse MultiGet(rocksdb::ReadOptions &options, std::vector<std::string> &keys,
+                           ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+        auto snapshot_lock = CHECK_SNAPSHOT(options);
+
+        MultiResponse response(keys.size());
+
+        // Indexes of the valid keys, sorted so RocksDB can skip sorting the batch itself
+        std::vector<size_t> order;
+        order.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (keys[i].empty()) {
+                response.statuses[i] = status::InvalidArgument("Key must be non-empty");
+            } else {
+                order.push_back(i);
+            }
+        }
+
+        rocksdb::ColumnFamilyHandle *cf = HANDLE(column_family);
+        const rocksdb::Comparator *comparator = cf->GetComparator();
+        std::sort(order.begin(), order.end(),
+                  [&](size_t a, size_t b) { return comparator->Compare(keys[a], keys[b]) < 0; });
+
+        std::vector<rocksdb::Slice> slices;
+        slices.reserve(order.size());
+        for (size_t i : order) {
+            slices.emplace_back(keys[i]);
+        }
+
+        std::vector<rocksdb::PinnableSlice> values(order.size());
+        std::vector<rocksdb::Status> statuses(order.size());
+        this->db->MultiGet(options, cf, order.size(), slices.data(), values.data(), statuses.data(), true);
+
+        for (size_t i = 0; i < order.size(); i++) {
+            response.statuses[order[i]] = statuses[i];
+            if (statuses[i].ok()) {
+                response.values[order[i]] = std::make_shared<Value>(std::move(values[i]));
+            }
+        }
+
+        return response;
+    }
+
+    Response Put(rocksdb::WriteOptions &options, rocksdb::Slice key, rocksdb::Slice value,
+                 ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
         status s;
@@ -82,13 +438,15 @@ class RocksDB {
         } else if (value.empty()) {
             s = status::InvalidArgument("Value must be non-empty");
         } else {
-            s = this->db->Put(options, key, value);
+            s = this->db->Put(options, HANDLE(column_family), key, value);
         }
 
         return Response(s);
     }
 
-    Response Merge(rocksdb::WriteOptions &options, std::string &key, std::string &value) {
+    Response Merge(rocksdb::WriteOptions &options, rocksdb::Slice key, rocksdb::Slice value,
+                   ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
         status s;
@@ -98,81 +456,174 @@ class RocksDB {
         } else if (value.empty()) {
             s = status::InvalidArgument("Value must be non-empty");
         } else {
-            s = this->db->Merge(options, key, value);
+            s = this->db->Merge(options, HANDLE(column_family), key, value);
         }
 
-        return Response(s, &value);
+        return Response(s);
     }
 
-    Response KeyMayExist(rocksdb::ReadOptions &options, std::string &key) {
+    // Stores `columns` as one wide-column entity, Get returns the value of the default column ""
+    Response PutEntity(rocksdb::WriteOptions &options, rocksdb::Slice key, std::map<std::string, std::string> &columns,
+                       ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
+#if ROCKSDB_MAJOR >= 8
         status s;
-        std::string value;
 
         if (key.empty()) {
             s = status::InvalidArgument("Key must be non-empty");
         } else {
-            bool found = this->db->KeyMayExist(options, key, &value);
-            s = found ? status::OK() : status::NotFound();
+            rocksdb::WideColumns wide_columns;
+            wide_columns.reserve(columns.size());
+            for (auto &[name, value] : columns) {
+                wide_columns.emplace_back(name, value);
+            }
+
+            s = this->db->PutEntity(options, HANDLE(column_family), key, wide_columns);
+        }
+
+        return Response(s);
+#else
+        return Response(status::NotSupported("PutEntity requires RocksDB 8.0 or newer"));
+#endif
+    }
+
+    // Reads the columns of `key`, only those in `names` if set, so single attributes of a large entity are not
+    // copied to python. A plain value is returned as the default column ""
+    EntityResponse GetEntity(rocksdb::ReadOptions &options, rocksdb::Slice key,
+                             std::optional<std::vector<std::string>> names = std::nullopt,
+                             ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+        auto snapshot_lock = CHECK_SNAPSHOT(options);
+
+#if ROCKSDB_MAJOR >= 8
+        if (key.empty()) {
+            return EntityResponse(status::InvalidArgument("Key must be non-empty"));
+        }
+
+        rocksdb::PinnableWideColumns result;
+        status s = this->db->GetEntity(options, HANDLE(column_family), key, &result);
+        if (!s.ok()) {
+            return EntityResponse(s);
         }
 
-        return Response(s, &value);
+        std::set<std::string> wanted;
+        if (names.has_value()) {
+            wanted.insert(names->begin(), names->end());
+        }
+
+        std::vector<std::pair<Binary, Binary>> columns;
+        for (auto &column : result.columns()) {
+            std::string name = column.name().ToString();
+            if (!names.has_value() || wanted.count(name)) {
+                columns.emplace_back(std::move(name), column.value().ToString());
+            }
+        }
+
+        return EntityResponse(s, std::move(columns));
+#else
+        return EntityResponse(status::NotSupported("GetEntity requires RocksDB 8.0 or newer"));
+#endif
     }
 
-    Response Del(rocksdb::WriteOptions &options, std::string &key) {
+    Response Write(rocksdb::WriteOptions &options, rocksdb::WriteBatchBase &batch) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
+        status s = this->db->Write(options, batch.GetWriteBatch());
+        return Response(s);
+    }
+
+    Response GetFromBatchAndDB(rocksdb::ReadOptions &options, rocksdb::WriteBatchWithIndex &batch,
+                               rocksdb::Slice key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+        auto snapshot_lock = CHECK_SNAPSHOT(options);
+
         status s;
+        auto value = std::make_shared<Value>();
 
         if (key.empty()) {
             s = status::InvalidArgument("Key must be non-empty");
         } else {
-            s = this->db->Delete(options, key);
+            s = batch.GetFromBatchAndDB(this->db, options, HANDLE(column_family), key, &value->slice);
         }
 
-        return Response(s);
+        return Response(s, value);
     }
 
-    Response GetOptions() {
+    Response KeyMayExist(rocksdb::ReadOptions &options, rocksdb::Slice key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
+        auto snapshot_lock = CHECK_SNAPSHOT(options);
+
+        status s;
+        std::string value;
+
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else {
+            bool found = this->db->KeyMayExist(options, HANDLE(column_family), key, &value);
+            s = found ? status::OK() : status::NotFound();
+        }
 
-        rocksdb::Options op = this->db->GetOptions();
-        status s = status::OK();
-        return Response(s, nullptr, &op);
+        return Response(s, std::make_shared<Value>(std::move(value)));
     }
 
-    Response SetOptions(py::dict &dict_options) {
+    Response Del(rocksdb::WriteOptions &options, rocksdb::Slice key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
         status s;
 
-        std::unordered_map<std::string, std::string> options;
-        for (std::pair<py::handle, py::handle> item : dict_options) {
-            options[item.first.cast<std::string>()] = item.second.cast<std::string>();
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else {
+            s = this->db->Delete(options, HANDLE(column_family), key);
         }
 
-        s = this->db->SetOptions(options);
+        return Response(s);
+    }
+
+    // Deletes the keys in [begin_key, end_key) with a single range tombstone
+    Response DeleteRange(rocksdb::WriteOptions &options, rocksdb::Slice begin_key, rocksdb::Slice end_key,
+                         ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
 
+        status s = this->db->DeleteRange(options, HANDLE(column_family), begin_key, end_key);
         return Response(s);
     }
 
-    Response SetDBOptions(py::dict &dict_options) {
+    OptionsResponse GetOptions(ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
-        status s;
+        return OptionsResponse(status::OK(), this->db->GetOptions(HANDLE(column_family)));
+    }
 
-        std::unordered_map<std::string, std::string> options;
-        for (std::pair<py::handle, py::handle> item : dict_options) {
-            options[item.first.cast<std::string>()] = item.second.cast<std::string>();
-        }
+    Response SetOptions(std::unordered_map<std::string, std::string> &options, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        status s = this->db->SetOptions(HANDLE(column_family), options);
+
+        return Response(s);
+    }
+
+    Response SetDBOptions(std::unordered_map<std::string, std::string> &options) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
 
-        s = this->db->SetDBOptions(options);
+        status s = this->db->SetDBOptions(options);
 
         return Response(s);
     }
 
-    Response GetProperty(std::string &key) {
+    Response GetProperty(std::string &key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
         status s;
@@ -181,21 +632,166 @@ class RocksDB {
         if (key.empty()) {
             s = status::InvalidArgument("Key must be non-empty");
         } else {
-            bool found = this->db->GetProperty(key, &value);
+            bool found = this->db->GetProperty(HANDLE(column_family), key, &value);
             s = found ? status::OK() : status::NotFound("Property '" + key + "' not found");
         }
 
-        return Response(s, &value);
+        return Response(s, std::make_shared<Value>(std::move(value)));
     }
 
-    Response Flush(rocksdb::FlushOptions &options) {
+    PropertiesResponse GetMapProperty(std::string &key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
-        status s = this->db->Flush(options);
+        if (key.empty()) {
+            return PropertiesResponse(status::InvalidArgument("Key must be non-empty"));
+        }
+
+        std::map<std::string, std::string> properties;
+        if (!this->db->GetMapProperty(HANDLE(column_family), key, &properties)) {
+            return PropertiesResponse(status::NotFound("Property '" + key + "' not found"));
+        }
+
+        return PropertiesResponse(status::OK(), std::move(properties));
+    }
+
+    // Reads many integer properties at once, unknown properties are left out of the result
+    std::map<std::string, uint64_t> GetIntProperties(std::vector<std::string> &keys,
+                                                     ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        rocksdb::ColumnFamilyHandle *handle = HANDLE(column_family);
+        std::map<std::string, uint64_t> properties;
+
+        for (auto &key : keys) {
+            uint64_t value;
+            if (this->db->GetIntProperty(handle, key, &value)) {
+                properties.emplace(key, value);
+            }
+        }
+
+        return properties;
+    }
+
+    Response Flush(rocksdb::FlushOptions &options, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        status s = this->db->Flush(options, HANDLE(column_family));
+        return Response(s);
+    }
+
+    // Compacts the keys in [begin, end], `std::nullopt` means before the first or after the last key
+    Response CompactRange(rocksdb::CompactRangeOptions &options, std::optional<std::string> begin = std::nullopt,
+                          std::optional<std::string> end = std::nullopt, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        rocksdb::Slice begin_slice, end_slice;
+        if (begin.has_value()) {
+            begin_slice = *begin;
+        }
+        if (end.has_value()) {
+            end_slice = *end;
+        }
+
+        status s = this->db->CompactRange(options, HANDLE(column_family), begin.has_value() ? &begin_slice : nullptr,
+                                          end.has_value() ? &end_slice : nullptr);
+        return Response(s);
+    }
+
+    Response CompactFiles(rocksdb::CompactionOptions &options, std::vector<std::string> &files, int output_level,
+                          ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        status s;
+
+        if (files.empty()) {
+            s = status::InvalidArgument("Files must be non-empty");
+        } else {
+            s = this->db->CompactFiles(options, HANDLE(column_family), files, output_level);
+        }
+
+        return Response(s);
+    }
+
+    // Marks the files overlapping [begin, end] for compaction, they are compacted in the background
+    Response SuggestCompactRange(std::optional<std::string> begin = std::nullopt,
+                                 std::optional<std::string> end = std::nullopt, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        rocksdb::Slice begin_slice, end_slice;
+        if (begin.has_value()) {
+            begin_slice = *begin;
+        }
+        if (end.has_value()) {
+            end_slice = *end;
+        }
+
+        status s = rocksdb::experimental::SuggestCompactRange(this->db, HANDLE(column_family),
+                                                              begin.has_value() ? &begin_slice : nullptr,
+                                                              end.has_value() ? &end_slice : nullptr);
+        return Response(s);
+    }
+
+    // Resumes automatic compactions disabled by `disable_auto_compactions`, for every open column family if
+    // `column_families` is empty
+    Response EnableAutoCompaction(std::vector<ColumnFamily *> column_families = {}) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        std::vector<rocksdb::ColumnFamilyHandle *> handles;
+        if (column_families.empty()) {
+            for (auto &item : this->column_families) {
+                handles.push_back(item.second->handle);
+            }
+        } else {
+            for (auto *column_family : column_families) {
+                handles.push_back(HANDLE(column_family));
+            }
+        }
+
+        status s = this->db->EnableAutoCompaction(handles);
+        return Response(s);
+    }
+
+    // Hard-links the live files into `checkpoint_dir` (copied across file systems), the checkpoint can be opened as
+    // a database on its own. The memtables are flushed first unless the WAL is smaller than `log_size_for_flush`
+    Response CreateCheckpoint(std::string &checkpoint_dir, uint64_t log_size_for_flush = 0) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        rocksdb::Checkpoint *checkpoint;
+        status s = rocksdb::Checkpoint::Create(this->db, &checkpoint);
+        if (s.ok()) {
+            std::unique_ptr<rocksdb::Checkpoint> guard(checkpoint);
+            s = checkpoint->CreateCheckpoint(checkpoint_dir, log_size_for_flush);
+        }
+
+        return Response(s);
+    }
+
+    Response IngestExternalFile(std::vector<std::string> &files, rocksdb::IngestExternalFileOptions &options,
+                                ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        status s;
+
+        if (files.empty()) {
+            s = status::InvalidArgument("Files must be non-empty");
+        } else {
+            s = this->db->IngestExternalFile(HANDLE(column_family), files, options);
+        }
+
         return Response(s);
     }
 
     Response TryCatchUpWithPrimary() {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
         CHECK_DB();
 
         status s;
@@ -209,6 +805,58 @@ class RocksDB {
         return Response(s);
     }
 
+    uint64_t GetLatestSequenceNumber() {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        CHECK_DB();
+
+        return this->db->GetLatestSequenceNumber();
+    }
+
+    // Catches up with the primary on a native thread every `interval` milliseconds, and on Linux also when the
+    // primary writes to its MANIFEST or WAL if `watch_files` is set, at most once per `min_interval` milliseconds.
+    // Restarts the thread if already running
+    Response StartAutoCatchUp(uint64_t interval, bool watch_files = false, uint64_t min_interval = 100) {
+        std::lock_guard<std::mutex> guard(this->catch_up_mutex);
+        {
+            std::shared_lock<std::shared_mutex> lock(this->mutex);
+            CHECK_DB();
+
+            if (this->read_only == false) {
+                return Response(status::NotSupported("AutoCatchUp is not supported for non-secondary instance"));
+            } else if (interval == 0) {
+                return Response(status::InvalidArgument("interval must be greater than 0"));
+            }
+        }
+
+        this->catch_up.reset();
+        this->catch_up = std::make_unique<CatchUpScheduler>(
+            [this] { return this->TryCatchUpWithPrimary().status; }, [this] { return this->GetLatestSequenceNumber(); },
+            this->db_path, std::chrono::milliseconds(interval), watch_files, std::chrono::milliseconds(min_interval));
+
+        return Response(status::OK());
+    }
+
+    Response StopAutoCatchUp() {
+        std::lock_guard<std::mutex> guard(this->catch_up_mutex);
+
+        if (!this->catch_up) {
+            return Response(status::InvalidArgument("AutoCatchUp is not running"));
+        }
+
+        this->catch_up.reset();
+        return Response(status::OK());
+    }
+
+    std::optional<CatchUpStats> GetCatchUpStats() {
+        std::lock_guard<std::mutex> guard(this->catch_up_mutex);
+
+        if (!this->catch_up) {
+            return std::nullopt;
+        }
+
+        return this->catch_up->Stats();
+    }
+
     static std::unordered_map<std::string, std::string> GetRocksBuildProperties() {
         return ROCKSDB_NAMESPACE::GetRocksBuildProperties();
     }
@@ -222,8 +870,39 @@ class RocksDB {
     }
 
     Response Close() {
+        // The catch-up thread takes the lock itself, stop it first
+        {
+            std::lock_guard<std::mutex> guard(this->catch_up_mutex);
+            this->catch_up.reset();
+        }
+
+        // Wait for in-flight requests, they run without the GIL
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+
         if (this->is_running) {
             this->is_running = false;
+
+            // Iterators, transactions and column family handles must be released before closing the database
+            std::lock_guard<std::mutex> guard(this->iterators_mutex);
+            for (auto *iterator : this->iterators) {
+                iterator->reset();
+            }
+            std::lock_guard<std::mutex> transactions_guard(this->transactions_mutex);
+            for (auto *transaction : this->transactions) {
+                transaction->reset();
+            }
+            for (auto &item : this->column_families) {
+                this->db->DestroyColumnFamilyHandle(item.second->handle);
+                item.second->handle = nullptr;
+            }
+            this->column_families.clear();
+
+            std::unique_lock<std::shared_mutex> snapshots_guard(this->snapshots_mutex);
+            for (auto *snapshot : this->snapshots) {
+                this->db->ReleaseSnapshot(snapshot);
+            }
+            this->snapshots.clear();
+
             status s = this->db->Close();
             return Response(s);
         } else {
@@ -232,9 +911,274 @@ class RocksDB {
     }
 
    private:
+    friend class Iterator;
+    friend class Snapshot;
+    friend class Transaction;
+    friend class BackupEngine;
+
+    std::shared_mutex mutex;
+    std::mutex iterators_mutex;
+    std::unordered_set<std::unique_ptr<rocksdb::Iterator> *> iterators;
+    // Same object as `db` when opened as a transaction database
+    rocksdb::TransactionDB *transaction_db = nullptr;
+    rocksdb::OptimisticTransactionDB *optimistic_transaction_db = nullptr;
+    std::mutex transactions_mutex;
+    std::unordered_set<std::unique_ptr<rocksdb::Transaction> *> transactions;
+    std::unordered_map<std::string, std::shared_ptr<ColumnFamily>> column_families;
+    std::shared_mutex snapshots_mutex;
+    std::unordered_set<const rocksdb::Snapshot *> snapshots;
+    std::string db_path;
+    std::mutex catch_up_mutex;
+    // Declared last so the thread is stopped before anything it uses is destroyed
+    std::unique_ptr<CatchUpScheduler> catch_up;
+
     void CHECK_DB() {
         if (!this->is_running) {
             throw std::runtime_error("Cannot invoke request database closed");
         }
     }
+
+    // Keeps the snapshot of `options` from being released until the returned lock goes out of scope
+    std::shared_lock<std::shared_mutex> CHECK_SNAPSHOT(const rocksdb::ReadOptions &options) {
+        if (options.snapshot == nullptr) {
+            return {};
+        }
+
+        std::shared_lock<std::shared_mutex> lock(this->snapshots_mutex);
+        if (this->snapshots.count(options.snapshot) == 0) {
+            throw std::runtime_error("Cannot invoke request snapshot released");
+        }
+
+        return lock;
+    }
+
+    // Resolve `column_family` to its handle, the default column family if `nullptr`
+    rocksdb::ColumnFamilyHandle *HANDLE(ColumnFamily *column_family) {
+        if (column_family == nullptr) {
+            return this->db->DefaultColumnFamily();
+        } else if (column_family->handle == nullptr) {
+            throw std::runtime_error("Cannot invoke request column family '" + column_family->name + "' dropped");
+        }
+
+        return column_family->handle;
+    }
+};
+
+class Iterator {
+   public:
+    Iterator(RocksDB &db, rocksdb::ReadOptions &options, std::optional<std::string> lower_bound = std::nullopt,
+             std::optional<std::string> upper_bound = std::nullopt, ColumnFamily *column_family = nullptr)
+        : db(&db), options(options), lower_bound(std::move(lower_bound)), upper_bound(std::move(upper_bound)) {
+        std::shared_lock<std::shared_mutex> lock(db.mutex);
+        db.CHECK_DB();
+
+        // ReadOptions only keeps pointers to the bounds, so they live as long as the iterator
+        if (this->lower_bound.has_value()) {
+            this->lower_slice = *this->lower_bound;
+            this->options.iterate_lower_bound = &this->lower_slice;
+        }
+        if (this->upper_bound.has_value()) {
+            this->upper_slice = *this->upper_bound;
+            this->options.iterate_upper_bound = &this->upper_slice;
+        }
+
+        // The iterator reads at the snapshot sequence number, the snapshot is only needed while creating it
+        auto snapshot_lock = db.CHECK_SNAPSHOT(this->options);
+        this->iterator.reset(db.db->NewIterator(this->options, db.HANDLE(column_family)));
+
+        std::lock_guard<std::mutex> guard(db.iterators_mutex);
+        db.iterators.insert(&this->iterator);
+    }
+
+    Iterator(const Iterator &) = delete;
+    Iterator &operator=(const Iterator &) = delete;
+
+    ~Iterator() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->db->iterators_mutex);
+
+        this->db->iterators.erase(&this->iterator);
+        this->iterator.reset();
+    }
+
+    bool Valid() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        return this->iterator->Valid();
+    }
+
+    void SeekToFirst() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        this->iterator->SeekToFirst();
+    }
+
+    void SeekToLast() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        this->iterator->SeekToLast();
+    }
+
+    void Seek(rocksdb::Slice key) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        this->iterator->Seek(key);
+    }
+
+    void SeekForPrev(rocksdb::Slice key) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        this->iterator->SeekForPrev(key);
+    }
+
+    void Next() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_VALID();
+
+        this->iterator->Next();
+    }
+
+    void Prev() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_VALID();
+
+        this->iterator->Prev();
+    }
+
+    Binary Key() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_VALID();
+
+        return this->iterator->key().ToString();
+    }
+
+    Binary Value() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_VALID();
+
+        return this->iterator->value().ToString();
+    }
+
+    rocksdb::Status Status() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        return this->iterator->status();
+    }
+
+    // Read up to `count` entries from the current position and leave the iterator after the last one
+    std::vector<std::pair<Binary, Binary>> Chunk(size_t count, bool reverse = false) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        std::vector<std::pair<Binary, Binary>> entries;
+        entries.reserve(count);
+
+        while (entries.size() < count && this->iterator->Valid()) {
+            entries.emplace_back(this->iterator->key().ToString(), this->iterator->value().ToString());
+
+            if (reverse) {
+                this->iterator->Prev();
+            } else {
+                this->iterator->Next();
+            }
+        }
+
+        return entries;
+    }
+
+    void Close() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        CHECK_ITERATOR();
+
+        this->iterator.reset();
+    }
+
+   private:
+    RocksDB *db;
+    rocksdb::ReadOptions options;
+    std::optional<std::string> lower_bound;
+    std::optional<std::string> upper_bound;
+    rocksdb::Slice lower_slice;
+    rocksdb::Slice upper_slice;
+    std::unique_ptr<rocksdb::Iterator> iterator;
+
+    void CHECK_ITERATOR() {
+        this->db->CHECK_DB();
+
+        if (!this->iterator) {
+            throw std::runtime_error("Cannot invoke request iterator closed");
+        }
+    }
+
+    void CHECK_VALID() {
+        CHECK_ITERATOR();
+
+        if (!this->iterator->Valid()) {
+            throw std::runtime_error("Iterator is not valid");
+        }
+    }
+};
+
+// Point in time view of the database for ReadOptions.snapshot. Released by `Release`, when the python object is
+// collected or when the database is closed, whichever comes first
+class Snapshot {
+   public:
+    Snapshot(RocksDB &db) : db(&db) {
+        std::shared_lock<std::shared_mutex> lock(db.mutex);
+        db.CHECK_DB();
+
+        this->snapshot = db.db->GetSnapshot();
+
+        std::unique_lock<std::shared_mutex> guard(db.snapshots_mutex);
+        db.snapshots.insert(this->snapshot);
+    }
+
+    Snapshot(const Snapshot &) = delete;
+    Snapshot &operator=(const Snapshot &) = delete;
+
+    ~Snapshot() {
+        this->Release();
+    }
+
+    const rocksdb::Snapshot *Get() {
+        if (this->snapshot == nullptr) {
+            throw std::runtime_error("Cannot invoke request snapshot released");
+        }
+
+        return this->snapshot;
+    }
+
+    uint64_t SequenceNumber() {
+        return this->Get()->GetSequenceNumber();
+    }
+
+    bool IsReleased() {
+        return this->snapshot == nullptr;
+    }
+
+    // Waits for in-flight reads that use the snapshot
+    void Release() {
+        if (this->snapshot == nullptr) {
+            return;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::unique_lock<std::shared_mutex> guard(this->db->snapshots_mutex);
+
+        // Already released by Close otherwise
+        if (this->db->snapshots.erase(this->snapshot) > 0) {
+            this->db->db->ReleaseSnapshot(this->snapshot);
+        }
+        this->snapshot = nullptr;
+    }
+
+   private:
+    RocksDB *db;
+    const rocksdb::Snapshot *snapshot = nullptr;
 };
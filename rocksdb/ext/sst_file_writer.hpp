@@ -0,0 +1,234 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+#include <rocksdb/sst_file_writer.h>
+
+#include <deque>
+#include <thread>
+
+class SstFileResponse {
+   public:
+    rocksdb::Status status;
+    std::vector<rocksdb::ExternalSstFileInfo> files;
+
+    SstFileResponse() = default;
+    SstFileResponse(rocksdb::Status s) : status(std::move(s)) {}
+};
+
+// Builds sorted string tables outside of the database, they are loaded with `RocksDB::IngestExternalFile`
+// without going through the WAL, memtables or level 0 compactions
+class SstFileWriter {
+   public:
+    using Items = std::vector<std::pair<std::string, std::string>>;
+
+    SstFileWriter(rocksdb::Options &options) : options(options), writer(rocksdb::EnvOptions(), this->options) {}
+
+    SstFileWriter(const SstFileWriter &) = delete;
+    SstFileWriter &operator=(const SstFileWriter &) = delete;
+
+    rocksdb::Status Open(const std::string &file_path) {
+        return this->writer.Open(file_path);
+    }
+
+    // Keys must be added in strictly increasing order according to the options comparator
+    rocksdb::Status Put(rocksdb::Slice key, rocksdb::Slice value) {
+        return this->writer.Put(key, value);
+    }
+
+    rocksdb::Status Merge(rocksdb::Slice key, rocksdb::Slice value) {
+        return this->writer.Merge(key, value);
+    }
+
+    rocksdb::Status Delete(rocksdb::Slice key) {
+        return this->writer.Delete(key);
+    }
+
+    rocksdb::Status DeleteRange(rocksdb::Slice begin_key, rocksdb::Slice end_key) {
+        return this->writer.DeleteRange(begin_key, end_key);
+    }
+
+    rocksdb::Status PutMany(Items &items, bool sort = false) {
+        if (sort) {
+            Sort(this->options.comparator, items);
+        }
+
+        for (auto &item : items) {
+            status s = this->writer.Put(item.first, item.second);
+            if (!s.ok()) {
+                return s;
+            }
+        }
+
+        return status::OK();
+    }
+
+    SstFileResponse Finish() {
+        SstFileResponse response;
+        response.files.resize(1);
+        response.status = this->writer.Finish(&response.files[0]);
+        if (!response.status.ok()) {
+            response.files.clear();
+        }
+
+        return response;
+    }
+
+    uint64_t FileSize() {
+        return this->writer.FileSize();
+    }
+
+    // Writes `items`, any python iterable of (key, value) pairs, to files of up to `chunk_size` items named
+    // `<path_prefix><index>.sst` on up to `threads` native threads. The files never overlap, so they can be ingested
+    // together into the bottommost level or with `ingest_behind`.
+    // With `sort` every item is read first and sorted globally (the last value of a duplicate key wins), so the
+    // whole input is held in memory. Without `sort` the items must already be in increasing key order and are
+    // streamed, only the chunks being written are held in memory, so generators of any length work
+    static SstFileResponse Generate(rocksdb::Options &options, py::iterable items, const std::string &path_prefix,
+                                    size_t threads, bool sort = true, size_t chunk_size = 1000000) {
+        if (threads == 0) {
+            return SstFileResponse(status::InvalidArgument("threads must be greater than 0"));
+        } else if (chunk_size == 0) {
+            return SstFileResponse(status::InvalidArgument("chunk_size must be greater than 0"));
+        }
+
+        // Deques, so workers can write to their slot while new chunks are appended
+        std::deque<rocksdb::ExternalSstFileInfo> files;
+        std::deque<rocksdb::Status> statuses;
+        std::vector<std::thread> workers;
+        size_t joined = 0;
+        std::string last_key;
+
+        auto join = [&](size_t in_flight) {
+            py::gil_scoped_release release;
+            while (workers.size() - joined > in_flight) {
+                workers[joined++].join();
+            }
+        };
+
+        // Writes items [begin, end) of `chunk` to the next file
+        auto submit = [&](std::shared_ptr<Items> chunk, size_t begin, size_t end) {
+            if (!workers.empty() && options.comparator->Compare((*chunk)[begin].first, last_key) <= 0) {
+                return status::InvalidArgument("Items must be in increasing key order unless sort is set");
+            }
+            last_key = (*chunk)[end - 1].first;
+
+            // Bound the memory to `threads` chunks being written plus the one being read
+            join(threads - 1);
+
+            auto &info = files.emplace_back();
+            auto &chunk_status = statuses.emplace_back();
+            std::string file_path = path_prefix + std::to_string(files.size() - 1) + ".sst";
+            workers.emplace_back([&options, &info, &chunk_status, chunk, begin, end, file_path] {
+                rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), options);
+                status s = writer.Open(file_path);
+                for (size_t i = begin; i < end && s.ok(); i++) {
+                    s = writer.Put((*chunk)[i].first, (*chunk)[i].second);
+                }
+                if (s.ok()) {
+                    s = writer.Finish(&info);
+                }
+
+                chunk_status = std::move(s);
+            });
+
+            return status::OK();
+        };
+
+        status s;
+        try {
+            if (sort) {
+                auto all = std::make_shared<Items>();
+                for (auto item : items) {
+                    all->push_back(item.cast<std::pair<std::string, std::string>>());
+                }
+                {
+                    py::gil_scoped_release release;
+                    Sort(options.comparator, *all, threads);
+                }
+
+                for (size_t begin = 0; begin < all->size() && s.ok(); begin += chunk_size) {
+                    s = submit(all, begin, std::min(begin + chunk_size, all->size()));
+                }
+            } else {
+                auto chunk = std::make_shared<Items>();
+                chunk->reserve(std::min<size_t>(chunk_size, 65536));
+                for (auto item : items) {
+                    chunk->push_back(item.cast<std::pair<std::string, std::string>>());
+                    if (chunk->size() == chunk_size) {
+                        s = submit(chunk, 0, chunk->size());
+                        if (!s.ok()) {
+                            break;
+                        }
+                        chunk = std::make_shared<Items>();
+                    }
+                }
+                if (s.ok() && !chunk->empty()) {
+                    s = submit(chunk, 0, chunk->size());
+                }
+            }
+        } catch (...) {
+            join(0);
+            throw;
+        }
+
+        join(0);
+
+        SstFileResponse response(s);
+        for (auto &chunk_status : statuses) {
+            if (response.status.ok() && !chunk_status.ok()) {
+                response.status = chunk_status;
+            }
+        }
+        if (response.status.ok()) {
+            response.files.assign(files.begin(), files.end());
+        }
+
+        return response;
+    }
+
+   private:
+    rocksdb::Options options;
+    rocksdb::SstFileWriter writer;
+
+    // Sorts by key and drops duplicates, the last value of a key wins like it would with consecutive puts.
+    // Parts are sorted on up to `threads` threads and merged, both steps are stable
+    static void Sort(const rocksdb::Comparator *comparator, Items &items, size_t threads = 1) {
+        auto less = [comparator](const auto &a, const auto &b) { return comparator->Compare(a.first, b.first) < 0; };
+
+        threads = std::max<size_t>(1, std::min(threads, items.size() / 65536));
+        std::vector<size_t> bounds;
+        for (size_t i = 0; i <= threads; i++) {
+            bounds.push_back(i * items.size() / threads);
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < threads; i++) {
+            workers.emplace_back(
+                [&, i] { std::stable_sort(items.begin() + bounds[i], items.begin() + bounds[i + 1], less); });
+        }
+        std::stable_sort(items.begin() + bounds[0], items.begin() + bounds[1], less);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+
+        for (size_t width = 1; width < threads; width *= 2) {
+            for (size_t i = 0; i + width < threads; i += 2 * width) {
+                std::inplace_merge(items.begin() + bounds[i], items.begin() + bounds[i + width],
+                                   items.begin() + bounds[std::min(i + 2 * width, threads)], less);
+            }
+        }
+
+        size_t size = 0;
+        for (size_t i = 0; i < items.size(); i++) {
+            if (size > 0 && comparator->Compare(items[size - 1].first, items[i].first) == 0) {
+                items[size - 1].second = std::move(items[i].second);
+            } else if (size != i) {
+                items[size++] = std::move(items[i]);
+            } else {
+                size++;
+            }
+        }
+        items.resize(size);
+    }
+};
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+#include <rocksdb/iostats_context.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/perf_level.h>
+#include <rocksdb/statistics.h>
+
+#include <thread>
+#include <unordered_map>
+
+// Every ticker and histogram of `statistics` in a single call, histograms are reported as
+// {"count", "sum", "min", "max", "average", "p50", "p95", "p99", "stddev"}
+inline py::dict StatisticsToDict(const rocksdb::Statistics &statistics) {
+    using namespace py::literals;
+
+    py::dict tickers;
+    for (auto &[ticker, name] : rocksdb::TickersNameMap) {
+        tickers[py::str(name)] = statistics.getTickerCount(ticker);
+    }
+
+    py::dict histograms;
+    for (auto &[histogram, name] : rocksdb::HistogramsNameMap) {
+        rocksdb::HistogramData data;
+        statistics.histogramData(histogram, &data);
+        histograms[py::str(name)] =
+            py::dict("count"_a = data.count, "sum"_a = data.sum, "min"_a = data.min, "max"_a = data.max,
+                     "average"_a = data.average, "p50"_a = data.median, "p95"_a = data.percentile95,
+                     "p99"_a = data.percentile99, "stddev"_a = data.standard_deviation);
+    }
+
+    return py::dict("tickers"_a = tickers, "histograms"_a = histograms);
+}
+
+// Captures rocksdb::PerfContext and rocksdb::IOStatsContext around requests. Both are thread local,
+// so the request has to run on the thread that called `Run` (or between `__enter__` and `__exit__`).
+// Counters of every captured request are summed, requests may be captured from several threads at once.
+// The contexts are never reset, a scope adds the difference between its end and its beginning, so scopes of
+// other instances (or other code reading the contexts) can be nested inside or around it
+class PerfContext {
+   public:
+    rocksdb::PerfLevel level;
+
+    PerfContext(rocksdb::PerfLevel level) : level(level) {}
+
+    PerfContext(const PerfContext &) = delete;
+    PerfContext &operator=(const PerfContext &) = delete;
+
+    // Scopes may nest and the same instance may be entered from several threads at once. Scopes are kept per
+    // thread since the contexts and the perf level are thread local
+    void Begin() {
+        Scope scope{rocksdb::GetPerfLevel(), {}};
+        rocksdb::SetPerfLevel(this->level);
+
+        std::lock_guard<std::mutex> guard(this->mutex);
+        auto &scopes = this->scopes[std::this_thread::get_id()];
+        // Only the outermost scope of this instance counts, so nested ones don't add the same work twice
+        if (scopes.empty()) {
+            scope.start = Counters();
+        }
+        scopes.push_back(std::move(scope));
+    }
+
+    void End() {
+        Scope scope;
+        {
+            std::lock_guard<std::mutex> guard(this->mutex);
+            auto it = this->scopes.find(std::this_thread::get_id());
+            if (it == this->scopes.end()) {
+                throw std::runtime_error("PerfContext was not entered on this thread");
+            }
+
+            scope = std::move(it->second.back());
+            it->second.pop_back();
+            if (it->second.empty()) {
+                this->scopes.erase(it);
+            }
+
+            if (!scope.start.empty()) {
+                std::vector<uint64_t> end = Counters();
+                for (size_t i = 0; i < end.size(); i++) {
+                    // A context reset by other code inside the scope restarts from 0
+                    this->counters[CounterName(i)] += end[i] >= scope.start[i] ? end[i] - scope.start[i] : end[i];
+                }
+            }
+            this->requests++;
+        }
+
+        rocksdb::SetPerfLevel(scope.previous);
+    }
+
+    // Calls `func(*args)` on the current thread with the contexts enabled
+    py::object Run(py::function func, py::args args) {
+        this->Begin();
+        try {
+            py::object result = func(*args);
+            this->End();
+            return result;
+        } catch (...) {
+            this->End();
+            throw;
+        }
+    }
+
+    py::dict ToDict() {
+        using namespace py::literals;
+        std::lock_guard<std::mutex> guard(this->mutex);
+
+        py::dict result("requests"_a = this->requests);
+        for (auto &[name, value] : this->counters) {
+            result[py::str(name)] = value;
+        }
+
+        return result;
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> guard(this->mutex);
+        this->counters.clear();
+        this->requests = 0;
+    }
+
+   private:
+    struct Scope {
+        // Level to restore when the scope ends
+        rocksdb::PerfLevel previous;
+        // Counters of the thread when the scope began, empty for a scope nested in another scope of this instance
+        std::vector<uint64_t> start;
+    };
+
+    std::mutex mutex;
+    std::map<std::string, uint64_t> counters;
+    uint64_t requests = 0;
+    // Open scopes, innermost last
+    std::unordered_map<std::thread::id, std::vector<Scope>> scopes;
+
+    // PERF_COUNTERS followed by IOSTATS_COUNTERS of the current thread
+    static std::vector<uint64_t> Counters() {
+        auto *perf_context = rocksdb::get_perf_context();
+        auto *iostats_context = rocksdb::get_iostats_context();
+
+        std::vector<uint64_t> values;
+        values.reserve(PERF_COUNTERS.size() + IOSTATS_COUNTERS.size());
+        for (auto &[name, field] : PERF_COUNTERS) {
+            values.push_back(perf_context->*field);
+        }
+        for (auto &[name, field] : IOSTATS_COUNTERS) {
+            values.push_back(iostats_context->*field);
+        }
+
+        return values;
+    }
+
+    static const char *CounterName(size_t index) {
+        if (index < PERF_COUNTERS.size()) {
+            return PERF_COUNTERS[index].first;
+        }
+        return IOSTATS_COUNTERS[index - PERF_COUNTERS.size()].first;
+    }
+
+    static inline const std::vector<std::pair<const char *, uint64_t rocksdb::PerfContext::*>> PERF_COUNTERS = {
+        {"user_key_comparison_count", &rocksdb::PerfContext::user_key_comparison_count},
+        {"block_cache_hit_count", &rocksdb::PerfContext::block_cache_hit_count},
+        {"block_read_count", &rocksdb::PerfContext::block_read_count},
+        {"block_read_byte", &rocksdb::PerfContext::block_read_byte},
+        {"block_read_time", &rocksdb::PerfContext::block_read_time},
+        {"block_cache_index_hit_count", &rocksdb::PerfContext::block_cache_index_hit_count},
+        {"block_cache_filter_hit_count", &rocksdb::PerfContext::block_cache_filter_hit_count},
+        {"block_checksum_time", &rocksdb::PerfContext::block_checksum_time},
+        {"block_decompress_time", &rocksdb::PerfContext::block_decompress_time},
+        {"get_read_bytes", &rocksdb::PerfContext::get_read_bytes},
+        {"multiget_read_bytes", &rocksdb::PerfContext::multiget_read_bytes},
+        {"iter_read_bytes", &rocksdb::PerfContext::iter_read_bytes},
+        {"internal_key_skipped_count", &rocksdb::PerfContext::internal_key_skipped_count},
+        {"internal_delete_skipped_count", &rocksdb::PerfContext::internal_delete_skipped_count},
+        {"get_snapshot_time", &rocksdb::PerfContext::get_snapshot_time},
+        {"get_from_memtable_time", &rocksdb::PerfContext::get_from_memtable_time},
+        {"get_from_memtable_count", &rocksdb::PerfContext::get_from_memtable_count},
+        {"get_post_process_time", &rocksdb::PerfContext::get_post_process_time},
+        {"get_from_output_files_time", &rocksdb::PerfContext::get_from_output_files_time},
+        {"seek_on_memtable_time", &rocksdb::PerfContext::seek_on_memtable_time},
+        {"seek_child_seek_time", &rocksdb::PerfContext::seek_child_seek_time},
+        {"seek_internal_seek_time", &rocksdb::PerfContext::seek_internal_seek_time},
+        {"find_next_user_entry_time", &rocksdb::PerfContext::find_next_user_entry_time},
+        {"write_wal_time", &rocksdb::PerfContext::write_wal_time},
+        {"write_memtable_time", &rocksdb::PerfContext::write_memtable_time},
+        {"write_delay_time", &rocksdb::PerfContext::write_delay_time},
+        {"write_pre_and_post_process_time", &rocksdb::PerfContext::write_pre_and_post_process_time},
+        {"db_mutex_lock_nanos", &rocksdb::PerfContext::db_mutex_lock_nanos},
+        {"db_condition_wait_nanos", &rocksdb::PerfContext::db_condition_wait_nanos},
+        {"bloom_memtable_hit_count", &rocksdb::PerfContext::bloom_memtable_hit_count},
+        {"bloom_memtable_miss_count", &rocksdb::PerfContext::bloom_memtable_miss_count},
+        {"bloom_sst_hit_count", &rocksdb::PerfContext::bloom_sst_hit_count},
+        {"bloom_sst_miss_count", &rocksdb::PerfContext::bloom_sst_miss_count},
+        {"key_lock_wait_time", &rocksdb::PerfContext::key_lock_wait_time},
+        {"key_lock_wait_count", &rocksdb::PerfContext::key_lock_wait_count},
+    };
+
+    static inline const std::vector<std::pair<const char *, uint64_t rocksdb::IOStatsContext::*>> IOSTATS_COUNTERS = {
+        {"bytes_written", &rocksdb::IOStatsContext::bytes_written},
+        {"bytes_read", &rocksdb::IOStatsContext::bytes_read},
+        {"open_nanos", &rocksdb::IOStatsContext::open_nanos},
+        {"allocate_nanos", &rocksdb::IOStatsContext::allocate_nanos},
+        {"write_nanos", &rocksdb::IOStatsContext::write_nanos},
+        {"read_nanos", &rocksdb::IOStatsContext::read_nanos},
+        {"range_sync_nanos", &rocksdb::IOStatsContext::range_sync_nanos},
+        {"fsync_nanos", &rocksdb::IOStatsContext::fsync_nanos},
+        {"prepare_write_nanos", &rocksdb::IOStatsContext::prepare_write_nanos},
+        {"logger_nanos", &rocksdb::IOStatsContext::logger_nanos},
+        {"cpu_write_nanos", &rocksdb::IOStatsContext::cpu_write_nanos},
+        {"cpu_read_nanos", &rocksdb::IOStatsContext::cpu_read_nanos},
+    };
+};
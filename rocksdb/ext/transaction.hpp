@@ -0,0 +1,237 @@
+#pragma once
+
+#include "rocksdb.hpp"
+
+// Read-modify-write unit of work on a database opened as TransactionDBType::pessimistic or optimistic.
+// Pessimistic transactions lock the keys they write (and read with GetForUpdate) until Commit or Rollback, waiting
+// up to the lock timeout for keys locked by others. Optimistic transactions take no locks and fail Commit with
+// Busy if a key they wrote or read with GetForUpdate changed since. Writes are only visible to other readers once
+// committed, an uncommitted transaction is rolled back when closed, collected or when the database is closed
+class Transaction {
+   public:
+    Transaction(RocksDB &db, rocksdb::WriteOptions &write_options, rocksdb::TransactionOptions &options) : db(&db) {
+        std::shared_lock<std::shared_mutex> lock(db.mutex);
+        db.CHECK_DB();
+
+        if (db.transaction_db != nullptr) {
+            this->transaction.reset(db.transaction_db->BeginTransaction(write_options, options));
+        } else if (db.optimistic_transaction_db != nullptr) {
+            rocksdb::OptimisticTransactionOptions optimistic_options;
+            optimistic_options.set_snapshot = options.set_snapshot;
+            this->transaction.reset(db.optimistic_transaction_db->BeginTransaction(write_options, optimistic_options));
+        } else {
+            throw std::runtime_error("Cannot begin transaction database not opened as TransactionDB");
+        }
+
+        std::lock_guard<std::mutex> guard(db.transactions_mutex);
+        db.transactions.insert(&this->transaction);
+    }
+
+    Transaction(const Transaction &) = delete;
+    Transaction &operator=(const Transaction &) = delete;
+
+    ~Transaction() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        std::lock_guard<std::mutex> transactions_guard(this->db->transactions_mutex);
+
+        this->db->transactions.erase(&this->transaction);
+        this->transaction.reset();
+    }
+
+    // Reads the transaction's own writes first. Uses the transaction snapshot (see SetSnapshot) unless
+    // `options.snapshot` is set
+    Response Get(rocksdb::ReadOptions &options, rocksdb::Slice key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+        auto snapshot_lock = this->db->CHECK_SNAPSHOT(options);
+
+        status s;
+        auto value = std::make_shared<Value>();
+
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else {
+            s = this->transaction->Get(READ_OPTIONS(options), this->db->HANDLE(column_family), key, &value->slice);
+        }
+
+        return Response(s, value);
+    }
+
+    // Like Get, but also locks `key` (pessimistic) or tracks it for conflict checking at Commit (optimistic).
+    // Fails with Busy if `key` changed after the transaction snapshot, or TimedOut if the lock was not acquired
+    Response GetForUpdate(rocksdb::ReadOptions &options, rocksdb::Slice key, ColumnFamily *column_family = nullptr,
+                          bool exclusive = true) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+        auto snapshot_lock = this->db->CHECK_SNAPSHOT(options);
+
+        status s;
+        auto value = std::make_shared<Value>();
+
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else {
+            s = this->transaction->GetForUpdate(READ_OPTIONS(options), this->db->HANDLE(column_family), key,
+                                                &value->slice, exclusive);
+        }
+
+        return Response(s, value);
+    }
+
+    Response Put(rocksdb::Slice key, rocksdb::Slice value, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        status s;
+
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else if (value.empty()) {
+            s = status::InvalidArgument("Value must be non-empty");
+        } else {
+            s = this->transaction->Put(this->db->HANDLE(column_family), key, value);
+        }
+
+        return Response(s);
+    }
+
+    Response Merge(rocksdb::Slice key, rocksdb::Slice value, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        status s;
+
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else if (value.empty()) {
+            s = status::InvalidArgument("Value must be non-empty");
+        } else {
+            s = this->transaction->Merge(this->db->HANDLE(column_family), key, value);
+        }
+
+        return Response(s);
+    }
+
+    Response Del(rocksdb::Slice key, ColumnFamily *column_family = nullptr) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        status s;
+
+        if (key.empty()) {
+            s = status::InvalidArgument("Key must be non-empty");
+        } else {
+            s = this->transaction->Delete(this->db->HANDLE(column_family), key);
+        }
+
+        return Response(s);
+    }
+
+    // Reads after this call see the database as of now, and GetForUpdate fails if a key changed since
+    void SetSnapshot() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        this->transaction->SetSnapshot();
+    }
+
+    void SetSavePoint() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        this->transaction->SetSavePoint();
+    }
+
+    // Undoes the writes since the last SetSavePoint and pops it, NotFound if there is none
+    Response RollbackToSavePoint() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        return Response(this->transaction->RollbackToSavePoint());
+    }
+
+    // Drops the last SetSavePoint and keeps its writes, NotFound if there is none
+    Response PopSavePoint() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        return Response(this->transaction->PopSavePoint());
+    }
+
+    // Only applies to pessimistic transactions, in milliseconds (negative waits forever)
+    void SetLockTimeout(int64_t timeout) {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        this->transaction->SetLockTimeout(timeout);
+    }
+
+    Response Commit() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        return Response(this->transaction->Commit());
+    }
+
+    Response Rollback() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        return Response(this->transaction->Rollback());
+    }
+
+    // Number of keys written by the transaction so far
+    uint64_t GetNumKeys() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        return this->transaction->GetNumKeys();
+    }
+
+    void Close() {
+        std::shared_lock<std::shared_mutex> lock(this->db->mutex);
+        std::lock_guard<std::mutex> guard(this->mutex);
+        CHECK_TRANSACTION();
+
+        this->transaction.reset();
+    }
+
+   private:
+    RocksDB *db;
+    std::unique_ptr<rocksdb::Transaction> transaction;
+    // rocksdb::Transaction is not thread safe, requests of one transaction run one at a time. Taken after the
+    // database lock, so Close waits for the request in flight and RocksDB::Close (exclusive) waits for all of them
+    std::mutex mutex;
+
+    void CHECK_TRANSACTION() {
+        this->db->CHECK_DB();
+
+        if (!this->transaction) {
+            throw std::runtime_error("Cannot invoke request transaction closed");
+        }
+    }
+
+    // Read at the transaction snapshot unless the caller asked for another one
+    rocksdb::ReadOptions READ_OPTIONS(const rocksdb::ReadOptions &options) {
+        rocksdb::ReadOptions read_options = options;
+        if (read_options.snapshot == nullptr) {
+            read_options.snapshot = this->transaction->GetSnapshot();
+        }
+
+        return read_options;
+    }
+};
@@ -0,0 +1,143 @@
+from typing import Tuple
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
+from .rocksdb_ext import _Iterator
+from .types import Binary, BINARY_TYPES
+
+import asyncio
+
+
+class Iterator:
+    """RocksDB iterator
+
+    Entries are fetched natively in chunks of `chunk_size`, so iterating costs one executor hop per chunk instead of per key.
+
+    Usage:
+        ```python
+        async with db.iterator(rocksdb.ReadOptions(), lower_bound="user:", upper_bound="user;") as iterator:
+            async for key, value in iterator:
+                print(key, value)
+        ```
+
+    Args:
+        loop (:py:class:`~asyncio.AbstractEventLoop`):
+            Event loop.
+
+        executer (:py:class:`~concurrent.futures.ThreadPoolExecutor`):
+            Executor used to run the native iterator.
+
+        iterator (:class:`~rocksdb.rocksdb_ext._Iterator`):
+            Native iterator.
+
+        chunk_size (``int``):
+            Number of entries fetched per executor hop.
+
+        reverse (``bool``):
+            If `True` iterate from the last key to the first.
+    """
+
+    def __init__(
+        self,
+        loop: asyncio.AbstractEventLoop,
+        executer: ThreadPoolExecutor,
+        iterator: _Iterator,
+        chunk_size: int,
+        reverse: bool,
+    ) -> None:
+        self.loop = loop
+        self.executer = executer
+        self.chunk_size = chunk_size
+        self.reverse = reverse
+        self.__iterator = iterator
+        self.__buffer = deque()
+        self.__positioned = False
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, exc_type, exc_val, exc_tb):
+        try:
+            await self.close()
+        except Exception:
+            pass
+
+    def __aiter__(self):
+        return self
+
+    async def __anext__(self) -> Tuple[bytes, bytes]:
+        if not self.__buffer:
+            if not self.__positioned:
+                if self.reverse:
+                    await self.seekToLast()
+                else:
+                    await self.seekToFirst()
+
+            chunk = await self.loop.run_in_executor(
+                self.executer, self.__iterator.Chunk, self.chunk_size, self.reverse
+            )
+
+            if not chunk:
+                status = self.__iterator.Status()
+                if not status.ok:
+                    raise RuntimeError(str(status))
+
+                raise StopAsyncIteration
+
+            self.__buffer.extend(chunk)
+
+        return self.__buffer.popleft()
+
+    async def __seek(self, func, *args) -> None:
+        self.__buffer.clear()
+        await self.loop.run_in_executor(self.executer, func, *args)
+        self.__positioned = True
+
+    async def seekToFirst(self) -> None:
+        """Position at the first key"""
+        await self.__seek(self.__iterator.SeekToFirst)
+
+    async def seekToLast(self) -> None:
+        """Position at the last key"""
+        await self.__seek(self.__iterator.SeekToLast)
+
+    async def seek(self, key: Binary) -> None:
+        """Position at the first key that is at or past `key`
+
+        Args:
+            key (``str`` | ``bytes``):
+                The key.
+
+        Raises:
+            `TypeError`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+
+        await self.__seek(self.__iterator.Seek, key)
+
+    async def seekForPrev(self, key: Binary) -> None:
+        """Position at the last key that is at or before `key`
+
+        Args:
+            key (``str`` | ``bytes``):
+                The key.
+
+        Raises:
+            `TypeError`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+
+        await self.__seek(self.__iterator.SeekForPrev, key)
+
+    async def close(self) -> None:
+        """Release the iterator
+
+        Raises:
+            `RuntimeError`
+        """
+
+        self.__buffer.clear()
+        await self.loop.run_in_executor(self.executer, self.__iterator.Close)
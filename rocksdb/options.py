@@ -1,4 +1,19 @@
-from .rocksdb_ext import _Options, _ReadOptions, _WriteOptions, _FlushOptions
+from .rocksdb_ext import (
+    _Options,
+    _ColumnFamilyOptions,
+    _ReadOptions,
+    _WriteOptions,
+    _FlushOptions,
+    _BlockBasedTableOptions,
+    _IngestExternalFileOptions,
+    _CompactRangeOptions,
+    _CompactionOptions,
+    _BackupEngineOptions,
+    _TransactionDBOptions,
+    _TransactionOptions,
+    Snapshot,
+)
+from typing import Optional
 from json import dumps
 
 
@@ -22,12 +37,31 @@ class Options(_Options):
         return dumps(self.to_dict(), indent=4)
 
 
+class ColumnFamilyOptions(_ColumnFamilyOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
 class ReadOptions(_ReadOptions):
     def __init__(self, **kwargs) -> None:
         super().__init__()
+        self.__snapshot = None
         if kwargs:
             set_kwargs(self, kwargs)
 
+    @property
+    def snapshot(self) -> Optional[Snapshot]:
+        """Read from this :class:`~rocksdb.Snapshot` instead of the latest state, see `RocksDB.snapshot`"""
+        return self.__snapshot
+
+    @snapshot.setter
+    def snapshot(self, value: Optional[Snapshot]) -> None:
+        # Replacing the reference lets the previous snapshot be released once nothing else uses it
+        self._SetSnapshot(value)
+        self.__snapshot = value
+
 
 class WriteOptions(_WriteOptions):
     def __init__(self, **kwargs) -> None:
@@ -41,3 +75,52 @@ class FlushOptions(_FlushOptions):
         super().__init__()
         if kwargs:
             set_kwargs(self, kwargs)
+
+
+class BlockBasedTableOptions(_BlockBasedTableOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
+class IngestExternalFileOptions(_IngestExternalFileOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
+class CompactRangeOptions(_CompactRangeOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
+class CompactionOptions(_CompactionOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
+class BackupEngineOptions(_BackupEngineOptions):
+    def __init__(self, backup_dir: str, **kwargs) -> None:
+        super().__init__(backup_dir)
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
+class TransactionDBOptions(_TransactionDBOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
+
+
+class TransactionOptions(_TransactionOptions):
+    def __init__(self, **kwargs) -> None:
+        super().__init__()
+        if kwargs:
+            set_kwargs(self, kwargs)
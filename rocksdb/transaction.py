@@ -0,0 +1,321 @@
+from concurrent.futures import ThreadPoolExecutor
+from .options import ReadOptions
+from .rocksdb_ext import _Transaction, ColumnFamily, Response
+from .types import Binary, BINARY_TYPES
+
+import asyncio
+
+
+class Transaction:
+    """RocksDB transaction, created by `RocksDB.transaction` on a database opened with `transaction_db`
+
+    Every request runs natively on the executor with the GIL released. Requests of one transaction run one at a time, in the order they reach the executor. Pessimistic transactions wait for keys locked by other transactions up to the lock timeout, `RocksDB.transaction` runs them on a separate pool of `transaction_workers` threads so a wait never holds up the other requests.
+
+    Usage:
+        ```python
+        async with db.transaction(rocksdb.WriteOptions()) as txn:
+            balance = await txn.getForUpdate(rocksdb.ReadOptions(), "balance")
+            await txn.put("balance", str(int(str(balance.value)) - 10))
+            response = await txn.commit()
+        ```
+
+    Args:
+        loop (:py:class:`~asyncio.AbstractEventLoop`):
+            Event loop.
+
+        executer (:py:class:`~concurrent.futures.ThreadPoolExecutor`):
+            Executor used to run the native transaction.
+
+        transaction (:class:`~rocksdb.rocksdb_ext._Transaction`):
+            Native transaction.
+    """
+
+    def __init__(
+        self,
+        loop: asyncio.AbstractEventLoop,
+        executer: ThreadPoolExecutor,
+        transaction: _Transaction,
+    ) -> None:
+        self.loop = loop
+        self.executer = executer
+        self.__transaction = transaction
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, exc_type, exc_val, exc_tb):
+        try:
+            await self.close()
+        except Exception:
+            pass
+
+    def __run(self, func, *args) -> asyncio.Future:
+        return self.loop.run_in_executor(self.executer, func, *args)
+
+    async def get(
+        self, options: ReadOptions, key: Binary, column_family: ColumnFamily = None
+    ) -> Response:
+        """Get the value of `key`, including the uncommitted writes of this transaction
+
+        Args:
+            options (:class:`~rocksdb.ReadOptions`):
+                RocksDB read options. Reads at the transaction snapshot unless `options.snapshot` is set.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, ReadOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        return await self.__run(self.__transaction.Get, options, key, column_family)
+
+    async def getForUpdate(
+        self,
+        options: ReadOptions,
+        key: Binary,
+        column_family: ColumnFamily = None,
+        exclusive: bool = True,
+    ) -> Response:
+        """Get the value of `key` and lock it (pessimistic) or check it for conflicts on `commit` (optimistic)
+
+        Args:
+            options (:class:`~rocksdb.ReadOptions`):
+                RocksDB read options.
+
+            key (``str`` | ``bytes``):
+                The key.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+            exclusive (``bool``, optional):
+                If `False` take a shared lock, other transactions can still read `key` for update. Defaults to True.
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`: `status.is_busy` if `key` changed after the transaction snapshot, `status.is_timed_out` if the lock was not acquired in time, `status.is_deadlock` if waiting would deadlock
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(options, ReadOptions):
+            raise TypeError(f"Invalid class '{type(options).__name__}'")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+        elif not isinstance(exclusive, bool):
+            raise TypeError("exclusive must be boolean")
+
+        return await self.__run(
+            self.__transaction.GetForUpdate, options, key, column_family, exclusive
+        )
+
+    async def put(
+        self, key: Binary, value: Binary, column_family: ColumnFamily = None
+    ) -> Response:
+        """Set `key` to `value` when the transaction commits
+
+        Args:
+            key (``str`` | ``bytes``):
+                The key.
+
+            value (``str`` | ``bytes``):
+                The value of the `key`.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(value, BINARY_TYPES):
+            raise TypeError("value must be str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        return await self.__run(self.__transaction.Put, key, value, column_family)
+
+    async def merge(
+        self, key: Binary, value: Binary, column_family: ColumnFamily = None
+    ) -> Response:
+        """Merge `value` into `key` when the transaction commits
+
+        Args:
+            key (``str`` | ``bytes``):
+                The key.
+
+            value (``str`` | ``bytes``):
+                The merge operand.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif not isinstance(value, BINARY_TYPES):
+            raise TypeError("value must be str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        return await self.__run(self.__transaction.Merge, key, value, column_family)
+
+    async def delete(self, key: Binary, column_family: ColumnFamily = None) -> Response:
+        """Remove `key` when the transaction commits
+
+        Args:
+            key (``str`` | ``bytes``):
+                The key.
+
+            column_family (:class:`~rocksdb.ColumnFamily`, optional):
+                Column family. Defaults to None (default column family).
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        if not isinstance(key, BINARY_TYPES):
+            raise TypeError("key must be str or bytes-like")
+        elif column_family is not None and not isinstance(column_family, ColumnFamily):
+            raise TypeError(f"Invalid class '{type(column_family).__name__}'")
+
+        return await self.__run(self.__transaction.Del, key, column_family)
+
+    async def setSnapshot(self) -> None:
+        """Read at the current state of the database from now on, `getForUpdate` fails if a key changed since
+
+        Raises:
+            `RuntimeError`
+        """
+
+        await self.__run(self.__transaction.SetSnapshot)
+
+    async def setSavePoint(self) -> None:
+        """Mark the current position, `rollbackToSavePoint` undoes the writes made after it
+
+        Raises:
+            `RuntimeError`
+        """
+
+        await self.__run(self.__transaction.SetSavePoint)
+
+    async def rollbackToSavePoint(self) -> Response:
+        """Undo the writes made since the last `setSavePoint` and remove it
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            `Response`: `status.is_not_found` if there is no save point
+        """
+
+        return await self.__run(self.__transaction.RollbackToSavePoint)
+
+    async def popSavePoint(self) -> Response:
+        """Remove the last `setSavePoint` and keep the writes made since
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            `Response`: `status.is_not_found` if there is no save point
+        """
+
+        return await self.__run(self.__transaction.PopSavePoint)
+
+    async def setLockTimeout(self, timeout: int) -> None:
+        """Set the lock timeout of this pessimistic transaction
+
+        Args:
+            timeout (``int``):
+                Timeout in milliseconds, negative waits forever.
+
+        Raises:
+            `TypeError`
+            `RuntimeError`
+        """
+
+        if not isinstance(timeout, int):
+            raise TypeError("timeout must be int")
+
+        await self.__run(self.__transaction.SetLockTimeout, timeout)
+
+    async def commit(self) -> Response:
+        """Write the transaction to the database and release its locks
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            `Response`: `status.is_busy` if an optimistic transaction conflicts with another write
+        """
+
+        return await self.__run(self.__transaction.Commit)
+
+    async def rollback(self) -> Response:
+        """Discard the writes of the transaction and release its locks
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            `Response`
+        """
+
+        return await self.__run(self.__transaction.Rollback)
+
+    async def getNumKeys(self) -> int:
+        """Number of keys written by the transaction so far
+
+        Raises:
+            `RuntimeError`
+
+        Returns:
+            ``int``
+        """
+
+        return await self.__run(self.__transaction.GetNumKeys)
+
+    async def close(self) -> None:
+        """Release the transaction, it is rolled back if not committed
+
+        Raises:
+            `RuntimeError`
+        """
+
+        await self.__run(self.__transaction.Close)
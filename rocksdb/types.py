@@ -0,0 +1,11 @@
+from typing import Union
+
+# `str` and `bytes` are passed to RocksDB without copying, other buffers are copied first
+Binary = Union[str, bytes, bytearray, memoryview]
+BINARY_TYPES = (str, bytes, bytearray, memoryview)
+
+
+def as_string(value: Binary) -> Union[str, bytes]:
+    """Convert bytes-like `value` for the native calls that take a list or optional of keys, which only accept
+    `str` and `bytes`"""
+    return value if isinstance(value, (str, bytes)) else bytes(value)
@@ -0,0 +1,29 @@
+"""Shared fixture of the tests, which need the built extension
+
+Usage:
+    python -m unittest discover -s tests
+"""
+
+from tempfile import TemporaryDirectory
+
+import rocksdb, unittest
+
+
+class DatabaseTestCase(unittest.IsolatedAsyncioTestCase):
+    """Every test gets an empty directory, `open` creates a database in it"""
+
+    def setUp(self) -> None:
+        self.directory = TemporaryDirectory()
+        self.path = self.directory.name + "/db"
+
+    def tearDown(self) -> None:
+        self.directory.cleanup()
+
+    def open(
+        self, path: str = None, options: rocksdb.Options = None, **kwargs
+    ) -> rocksdb.RocksDB:
+        return rocksdb.RocksDB(
+            path or self.path,
+            options or rocksdb.Options(create_if_missing=True),
+            **kwargs,
+        )
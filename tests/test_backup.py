@@ -0,0 +1,42 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class BackupTest(DatabaseTestCase):
+    async def test_checkpoint(self):
+        checkpoint = self.directory.name + "/checkpoint"
+
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "value")
+            response = await db.createCheckpoint(checkpoint)
+            self.assertTrue(response.status.ok)
+
+            # Writes after the checkpoint don't show up in it
+            await db.put(rocksdb.WriteOptions(), "other", "value")
+
+        async with self.open(checkpoint) as db:
+            response = await db.multiGet(rocksdb.ReadOptions(), ["key", "other"])
+            self.assertTrue(response.statuses[0].ok)
+            self.assertTrue(response.statuses[1].is_not_found)
+
+    async def test_backup_and_restore(self):
+        engine = rocksdb.BackupEngine(rocksdb.BackupEngineOptions(self.directory.name + "/backup"))
+        progress = []
+
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "value")
+            response = await db.createBackup(engine, flush_before_backup=True, progress=progress.append)
+            self.assertTrue(response.status.ok)
+
+        infos = engine.GetBackupInfo()
+        self.assertEqual([info.backup_id for info in infos], [response.backup_id])
+        self.assertTrue(engine.VerifyBackup(response.backup_id).status.ok)
+
+        restore = self.directory.name + "/restore"
+        self.assertTrue(engine.RestoreDBFromLatestBackup(restore, restore).status.ok)
+        engine.Close()
+
+        async with self.open(restore) as db:
+            response = await db.get(rocksdb.ReadOptions(), "key")
+            self.assertEqual(response.value, "value")
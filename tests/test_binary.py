@@ -0,0 +1,55 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class BinaryTest(DatabaseTestCase):
+    async def test_bytes_like_keys_and_values(self):
+        async with self.open() as db:
+            key, value = bytearray(b"\x00key"), memoryview(b"\xffvalue")
+            response = await db.put(rocksdb.WriteOptions(), key, value)
+            self.assertTrue(response.status.ok)
+
+            # The same key through every accepted type
+            for lookup in (key, bytes(key), memoryview(key)):
+                response = await db.get(rocksdb.ReadOptions(), lookup)
+                self.assertTrue(response.status.ok)
+                self.assertEqual(bytes(response.value), b"\xffvalue")
+
+            response = await db.delete(rocksdb.WriteOptions(), memoryview(bytes(key)))
+            self.assertTrue(response.status.ok)
+            response = await db.get(rocksdb.ReadOptions(), key)
+            self.assertTrue(response.status.is_not_found)
+            self.assertIsNone(response.value)
+
+    async def test_value_buffer(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "välue")
+            value = (await db.get(rocksdb.ReadOptions(), "key")).value
+
+            self.assertEqual(str(value), "välue")
+            self.assertEqual(bytes(value), "välue".encode())
+            self.assertEqual(len(value), len("välue".encode()))
+            self.assertEqual(value, "välue")
+
+            view = memoryview(value)
+            self.assertTrue(view.readonly)
+            self.assertEqual(view.tobytes(), "välue".encode())
+
+    async def test_invalid_key(self):
+        async with self.open() as db:
+            with self.assertRaises(TypeError):
+                await db.get(rocksdb.ReadOptions(), 1)
+
+    async def test_bytes_like_everywhere(self):
+        async with self.open() as db:
+            for key in (b"a", b"b", b"c"):
+                await db.put(rocksdb.WriteOptions(), key, key)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), [bytearray(b"a"), memoryview(b"c")])
+            self.assertEqual(response.values, [b"a", b"c"])
+
+            async with db.iterator(
+                rocksdb.ReadOptions(), lower_bound=bytearray(b"b"), upper_bound=memoryview(b"c")
+            ) as iterator:
+                self.assertEqual([key async for key, _ in iterator], [b"b"])
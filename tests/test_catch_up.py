@@ -0,0 +1,63 @@
+from base import DatabaseTestCase
+
+import rocksdb, asyncio, sys, unittest
+
+
+class CatchUpTest(DatabaseTestCase):
+    def open_secondary(self) -> rocksdb.RocksDB:
+        return self.open(
+            options=rocksdb.Options(max_open_files=-1),
+            read_only=True,
+            secondary_path=self.directory.name + "/secondary",
+        )
+
+    async def test_auto_catch_up(self):
+        async with self.open() as primary, self.open_secondary() as secondary:
+            self.assertIsNone(secondary.getCatchUpStats())
+
+            response = await secondary.startAutoCatchUp(interval=0.05)
+            self.assertTrue(response.status.ok)
+
+            await primary.put(rocksdb.WriteOptions(), "key", "value")
+
+            # The secondary picks the write up without being asked to
+            for _ in range(100):
+                response = await secondary.get(rocksdb.ReadOptions(), "key")
+                if response.status.ok:
+                    break
+                await asyncio.sleep(0.05)
+            self.assertEqual(response.value, "value")
+
+            stats = secondary.getCatchUpStats()
+            self.assertGreater(stats.catch_ups, 0)
+            self.assertEqual(stats.failures, 0)
+            self.assertTrue(stats.last_status.ok)
+
+            response = await secondary.stopAutoCatchUp()
+            self.assertTrue(response.status.ok)
+            self.assertIsNone(secondary.getCatchUpStats())
+
+    @unittest.skipUnless(sys.platform.startswith("linux"), "watch_files uses inotify")
+    async def test_watch_files(self):
+        async with self.open() as primary, self.open_secondary() as secondary:
+            # The interval alone would not catch up during the test
+            response = await secondary.startAutoCatchUp(60, watch_files=True, min_interval=0.05)
+            self.assertTrue(response.status.ok)
+
+            for i in range(10):
+                await primary.put(rocksdb.WriteOptions(), f"key-{i}", "value")
+
+            for _ in range(100):
+                response = await secondary.get(rocksdb.ReadOptions(), "key-9")
+                if response.status.ok:
+                    break
+                await asyncio.sleep(0.05)
+            self.assertEqual(response.value, "value")
+
+            # A burst of writes is replayed by fewer catch-ups than writes
+            self.assertLess(secondary.getCatchUpStats().catch_ups, 10)
+
+    async def test_primary_not_supported(self):
+        async with self.open() as db:
+            with self.assertRaises(rocksdb.NotSupported):
+                await db.startAutoCatchUp()
@@ -0,0 +1,49 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class ColumnFamilyTest(DatabaseTestCase):
+    async def test_create_and_drop(self):
+        async with self.open() as db:
+            users = await db.createColumnFamily(rocksdb.ColumnFamilyOptions(), "users")
+            self.assertEqual(sorted(db.listColumnFamilies()), ["default", "users"])
+            self.assertEqual(db.getColumnFamily("users").name, "users")
+
+            await db.put(rocksdb.WriteOptions(), "key", "users", users)
+            response = await db.get(rocksdb.ReadOptions(), "key", users)
+            self.assertEqual(response.value, "users")
+            response = await db.get(rocksdb.ReadOptions(), "key")
+            self.assertTrue(response.status.is_not_found)
+
+            response = await db.dropColumnFamily(users)
+            self.assertTrue(response.status.ok)
+            self.assertTrue(users.is_dropped)
+            self.assertEqual(db.listColumnFamilies(), ["default"])
+            with self.assertRaises(ValueError):
+                db.getColumnFamily("users")
+
+    async def test_batch_across_column_families(self):
+        async with self.open() as db:
+            users = await db.createColumnFamily(rocksdb.ColumnFamilyOptions(), "users")
+
+            batch = rocksdb.WriteBatch()
+            batch.Put("key", "default")
+            batch.Put("key", "users", users)
+            response = await db.write(rocksdb.WriteOptions(), batch)
+            self.assertTrue(response.status.ok)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["key"], users)
+            self.assertEqual(response.values, ["users"])
+            response = await db.get(rocksdb.ReadOptions(), "key")
+            self.assertEqual(response.value, "default")
+
+    async def test_reopen(self):
+        async with self.open() as db:
+            users = await db.createColumnFamily(rocksdb.ColumnFamilyOptions(), "users")
+            await db.put(rocksdb.WriteOptions(), "key", "users", users)
+
+        # Column families found on disk are opened again
+        async with self.open() as db:
+            response = await db.get(rocksdb.ReadOptions(), "key", db.getColumnFamily("users"))
+            self.assertEqual(response.value, "users")
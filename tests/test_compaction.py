@@ -0,0 +1,45 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class CompactionTest(DatabaseTestCase):
+    async def test_delete_range(self):
+        async with self.open() as db:
+            for key in ("a", "b", "c", "d"):
+                await db.put(rocksdb.WriteOptions(), key, key)
+
+            response = await db.deleteRange(rocksdb.WriteOptions(), "b", "d")
+            self.assertTrue(response.status.ok)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["a", "b", "c", "d"])
+            self.assertEqual(
+                [status.ok for status in response.statuses], [True, False, False, True]
+            )
+
+    async def test_prefix_drop_filter(self):
+        prefix_filter = rocksdb.PrefixDropFilter(["tenant-1:"])
+        prefix_filter.Add("tenant-3:")
+        prefix_filter.Remove("tenant-3:")
+        self.assertEqual(prefix_filter.prefixes, ["tenant-1:"])
+
+        options = rocksdb.Options(create_if_missing=True)
+        options.compaction_filter_factory = prefix_filter
+
+        async with self.open(options=options) as db:
+            for key in ("tenant-1:a", "tenant-1:b", "tenant-2:a", "tenant-3:a"):
+                await db.put(rocksdb.WriteOptions(), key, "value")
+
+            response = await db.compactRange(
+                rocksdb.CompactRangeOptions(
+                    bottommost_level_compaction=rocksdb.BottommostLevelCompaction.force
+                )
+            )
+            self.assertTrue(response.status.ok)
+
+            response = await db.multiGet(
+                rocksdb.ReadOptions(), ["tenant-1:a", "tenant-1:b", "tenant-2:a", "tenant-3:a"]
+            )
+            self.assertEqual(
+                [status.ok for status in response.statuses], [False, False, True, True]
+            )
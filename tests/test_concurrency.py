@@ -0,0 +1,32 @@
+from base import DatabaseTestCase
+
+import rocksdb, asyncio
+
+
+class ConcurrencyTest(DatabaseTestCase):
+    async def test_concurrent_requests(self):
+        async with self.open(workers=4) as db:
+            keys = [f"key-{i:04d}" for i in range(1000)]
+
+            responses = await asyncio.gather(
+                *(db.put(rocksdb.WriteOptions(), key, key) for key in keys)
+            )
+            self.assertTrue(all(response.status.ok for response in responses))
+
+            responses = await asyncio.gather(
+                *(db.get(rocksdb.ReadOptions(), key) for key in keys)
+            )
+            self.assertEqual([response.value for response in responses], keys)
+
+    async def test_close_waits_for_requests(self):
+        db = self.open(workers=4)
+        await db.put(rocksdb.WriteOptions(), "key", "value")
+
+        gets = [db.get(rocksdb.ReadOptions(), "key") for _ in range(100)]
+        results = await asyncio.gather(*gets, db.close(), return_exceptions=True)
+
+        # Requests queued behind `close` fail cleanly, the others read the value
+        for result in results[:-1]:
+            if not isinstance(result, Exception):
+                self.assertEqual(result.value, "value")
+        self.assertTrue(results[-1].status.ok)
@@ -0,0 +1,80 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class IngestTest(DatabaseTestCase):
+    async def test_generate_and_ingest(self):
+        items = ((f"key-{i:03d}", str(i)) for i in range(100))
+        response = rocksdb.SstFileWriter.Generate(
+            rocksdb.Options(), items, self.directory.name + "/bulk-", threads=2, sort=False, chunk_size=25
+        )
+        self.assertTrue(response.status.ok)
+        self.assertEqual(len(response.files), 4)
+        self.assertEqual(sum(file.num_entries for file in response.files), 100)
+
+        # Sorted input is written as consecutive ranges that never overlap
+        for previous, file in zip(response.files, response.files[1:]):
+            self.assertLess(previous.largest_key, file.smallest_key)
+
+        async with self.open() as db:
+            response = await db.ingestExternalFile(
+                rocksdb.IngestExternalFileOptions(move_files=True), response.file_paths
+            )
+            self.assertTrue(response.status.ok)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["key-000", "key-099"])
+            self.assertEqual(response.values, ["0", "99"])
+
+    async def test_generate_unsorted(self):
+        items = [(f"key-{i % 10}", str(i)) for i in reversed(range(100))]
+        response = rocksdb.SstFileWriter.Generate(
+            rocksdb.Options(), iter(items), self.directory.name + "/bulk-", threads=2, chunk_size=3
+        )
+        self.assertTrue(response.status.ok)
+
+        # Sorted globally, not per chunk, so the files still never overlap
+        self.assertEqual(len(response.files), 4)
+        for previous, file in zip(response.files, response.files[1:]):
+            self.assertLess(previous.largest_key, file.smallest_key)
+
+        options = rocksdb.Options(create_if_missing=True, allow_ingest_behind=True)
+        async with self.open(options=options) as db:
+            await db.put(rocksdb.WriteOptions(), "key-0", "db")
+
+            # Ingested behind the existing data, which keeps precedence
+            response = await db.ingestExternalFile(
+                rocksdb.IngestExternalFileOptions(ingest_behind=True), response.file_paths
+            )
+            self.assertTrue(response.status.ok)
+
+            # Within the input the last value of a key wins, like with consecutive puts
+            response = await db.multiGet(rocksdb.ReadOptions(), ["key-0", "key-9"])
+            self.assertEqual(response.values, ["db", "9"])
+
+    async def test_generate_requires_order_without_sort(self):
+        items = [("b", "2"), ("a", "1")]
+        response = rocksdb.SstFileWriter.Generate(
+            rocksdb.Options(), items, self.directory.name + "/bulk-", sort=False, chunk_size=1
+        )
+        self.assertTrue(response.status.is_invalid_argument)
+
+    async def test_writer(self):
+        path = self.directory.name + "/single.sst"
+        writer = rocksdb.SstFileWriter(rocksdb.Options())
+        self.assertTrue(writer.Open(path).ok)
+        self.assertTrue(writer.PutMany([("b", "2"), ("a", "1"), ("a", "3")], sort=True).ok)
+
+        # Out of order keys are rejected
+        self.assertFalse(writer.Put("a", "4").ok)
+
+        response = writer.Finish()
+        self.assertTrue(response.status.ok)
+        self.assertEqual(response.files[0].num_entries, 2)
+
+        async with self.open() as db:
+            response = await db.ingestExternalFile(rocksdb.IngestExternalFileOptions(), [path])
+            self.assertTrue(response.status.ok)
+
+            response = await db.get(rocksdb.ReadOptions(), "a")
+            self.assertEqual(response.value, "3")
@@ -0,0 +1,31 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class IteratorTest(DatabaseTestCase):
+    async def asyncSetUp(self) -> None:
+        self.db = self.open()
+        batch = rocksdb.WriteBatch()
+        batch.PutMany([(f"key-{i}", str(i)) for i in range(10)])
+        await self.db.write(rocksdb.WriteOptions(), batch)
+
+    async def asyncTearDown(self) -> None:
+        await self.db.close()
+
+    async def scan(self, **kwargs) -> list:
+        async with self.db.iterator(rocksdb.ReadOptions(), **kwargs) as iterator:
+            return [item async for item in iterator]
+
+    async def test_scan_in_chunks(self):
+        items = await self.scan(chunk_size=3)
+        self.assertEqual(items, [(f"key-{i}".encode(), str(i).encode()) for i in range(10)])
+
+    async def test_bounds_and_reverse(self):
+        items = await self.scan(lower_bound="key-2", upper_bound="key-5", reverse=True)
+        self.assertEqual([key for key, _ in items], [b"key-4", b"key-3", b"key-2"])
+
+    async def test_seek(self):
+        async with self.db.iterator(rocksdb.ReadOptions(), chunk_size=2) as iterator:
+            await iterator.seek(b"key-7")
+            self.assertEqual([key async for key, _ in iterator], [b"key-7", b"key-8", b"key-9"])
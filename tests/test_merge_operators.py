@@ -0,0 +1,49 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class MergeOperatorsTest(DatabaseTestCase):
+    async def merge(
+        self, merge_operator: rocksdb.MergeOperator, values: list, path: str = None
+    ) -> rocksdb.Response:
+        options = rocksdb.Options(create_if_missing=True, merge_operator=merge_operator)
+
+        async with self.open(path, options) as db:
+            for value in values:
+                response = await db.merge(rocksdb.WriteOptions(), "key", value)
+                self.assertTrue(response.status.ok)
+
+            return await db.get(rocksdb.ReadOptions(), "key")
+
+    async def test_uint64_add(self):
+        encode = rocksdb.MergeOperator.EncodeUInt64
+        response = await self.merge(rocksdb.MergeOperator.UInt64Add(), [encode(1), encode(2), encode(39)])
+        self.assertEqual(rocksdb.MergeOperator.DecodeUInt64(bytes(response.value)), 42)
+
+    async def test_uint64_add_malformed(self):
+        encode = rocksdb.MergeOperator.EncodeUInt64
+        response = await self.merge(rocksdb.MergeOperator.UInt64Add(), [encode(1), "bad"])
+        self.assertTrue(response.status.is_corruption)
+
+        with self.assertRaises(ValueError):
+            rocksdb.MergeOperator.DecodeUInt64(b"bad")
+
+    async def test_string_append(self):
+        response = await self.merge(rocksdb.MergeOperator.StringAppend(","), ["a", "b", "c"])
+        self.assertEqual(response.value, "a,b,c")
+
+    async def test_bounded_list_append(self):
+        response = await self.merge(rocksdb.MergeOperator.BoundedListAppend(2), ["a", "b", "c"])
+        self.assertEqual(response.value, "b,c")
+
+    async def test_max_and_min(self):
+        response = await self.merge(rocksdb.MergeOperator.Max(), ["b", "c", "a"])
+        self.assertEqual(response.value, "c")
+
+        response = await self.merge(rocksdb.MergeOperator.Min(), ["b", "c", "a"], self.path + "-min")
+        self.assertEqual(response.value, "a")
+
+    async def test_put_if_absent(self):
+        response = await self.merge(rocksdb.MergeOperator.PutIfAbsent(), ["first", "second"])
+        self.assertEqual(response.value, "first")
@@ -0,0 +1,21 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class MultiGetTest(DatabaseTestCase):
+    async def test_multi_get(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "a", "1")
+            await db.put(rocksdb.WriteOptions(), "b", "2")
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["b", "missing", "a", ""])
+            self.assertEqual(len(response), 4)
+
+            # Statuses and values follow the order of the keys, not the sorted lookup order
+            b, missing, a, empty = response.statuses
+            self.assertTrue(b.ok and a.ok)
+            self.assertTrue(missing.is_not_found)
+            self.assertTrue(empty.is_invalid_argument)
+            self.assertEqual(response.values[0], "2")
+            self.assertEqual(response.values[2], "1")
@@ -0,0 +1,38 @@
+from base import DatabaseTestCase
+
+import rocksdb, asyncio
+
+
+class NativeExecutorTest(DatabaseTestCase):
+    async def test_requests(self):
+        async with self.open(workers=4, native_executor=True) as db:
+            keys = [f"key-{i:04d}" for i in range(1000)]
+
+            responses = await asyncio.gather(
+                *(db.put(rocksdb.WriteOptions(), key, key) for key in keys)
+            )
+            self.assertTrue(all(response.status.ok for response in responses))
+
+            responses = await asyncio.gather(
+                *(db.get(rocksdb.ReadOptions(), key) for key in keys)
+            )
+            self.assertEqual([response.value for response in responses], keys)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), keys[:3] + ["missing"])
+            self.assertEqual(response.values[:3], keys[:3])
+            self.assertTrue(response.statuses[3].is_not_found)
+
+    async def test_write_and_delete(self):
+        async with self.open(native_executor=True) as db:
+            batch = rocksdb.WriteBatch()
+            batch.PutMany([("a", "1"), ("b", "2")])
+            response = await db.write(rocksdb.WriteOptions(), batch)
+            self.assertTrue(response.status.ok)
+
+            response = await db.delete(rocksdb.WriteOptions(), "a")
+            self.assertTrue(response.status.ok)
+
+            response = await db.get(rocksdb.ReadOptions(), "a")
+            self.assertTrue(response.status.is_not_found)
+            response = await db.get(rocksdb.ReadOptions(), "b")
+            self.assertEqual(response.value, "2")
@@ -0,0 +1,37 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class ResourceSharingTest(DatabaseTestCase):
+    def test_rate_limiter(self):
+        rate_limiter = rocksdb.RateLimiter.NewGenericRateLimiter(1 << 20)
+        self.assertEqual(rate_limiter.bytes_per_second, 1 << 20)
+
+        rate_limiter.bytes_per_second = 2 << 20
+        self.assertEqual(rate_limiter.to_dict()["bytes_per_second"], 2 << 20)
+
+    async def test_shared_managers(self):
+        cache = rocksdb.Cache.NewLRUCache(64 << 20)
+        options = rocksdb.Options(
+            create_if_missing=True,
+            rate_limiter=rocksdb.RateLimiter.NewGenericRateLimiter(64 << 20),
+            write_buffer_manager=rocksdb.WriteBufferManager(32 << 20, cache),
+            sst_file_manager=rocksdb.SstFileManager.NewSstFileManager(),
+        )
+        self.assertTrue(options.write_buffer_manager.cost_to_cache)
+
+        async with self.open(self.path, options) as db, self.open(self.path + "-2", options) as other:
+            for database in (db, other):
+                await database.put(rocksdb.WriteOptions(), "key", "value" * 100)
+
+            # Both memtables are accounted in the one manager, and charged to the cache
+            self.assertGreater(options.write_buffer_manager.memory_usage, 0)
+            self.assertGreater(cache.usage, 0)
+
+            for database in (db, other):
+                response = await database.flush(rocksdb.FlushOptions())
+                self.assertTrue(response.status.ok)
+
+            self.assertGreater(options.sst_file_manager.total_size, 0)
+            self.assertGreater(options.rate_limiter.total_bytes_through, 0)
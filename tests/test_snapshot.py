@@ -0,0 +1,47 @@
+from base import DatabaseTestCase
+
+import rocksdb, gc, weakref
+
+
+class SnapshotTest(DatabaseTestCase):
+    async def test_snapshot(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "old")
+
+            async with db.snapshot() as snapshot:
+                await db.put(rocksdb.WriteOptions(), "key", "new")
+                await db.put(rocksdb.WriteOptions(), "other", "new")
+
+                options = rocksdb.ReadOptions(snapshot=snapshot)
+                response = await db.get(options, "key")
+                self.assertEqual(response.value, "old")
+                response = await db.multiGet(options, ["key", "other"])
+                self.assertTrue(response.statuses[1].is_not_found)
+
+            self.assertTrue(snapshot.is_released)
+            response = await db.get(rocksdb.ReadOptions(), "key")
+            self.assertEqual(response.value, "new")
+
+    async def test_released_snapshot(self):
+        async with self.open() as db:
+            async with db.snapshot() as snapshot:
+                options = rocksdb.ReadOptions(snapshot=snapshot)
+
+            # Reads through a released snapshot raise instead of dereferencing it
+            with self.assertRaises(RuntimeError):
+                await db.get(options, "key")
+
+    async def test_reassign_releases_reference(self):
+        async with self.open() as db:
+            options = rocksdb.ReadOptions()
+
+            async with db.snapshot() as snapshot:
+                options.snapshot = snapshot
+                reference = weakref.ref(snapshot)
+
+            del snapshot
+            options.snapshot = None
+            gc.collect()
+
+            # ReadOptions no longer keeps every snapshot it was given alive
+            self.assertIsNone(reference())
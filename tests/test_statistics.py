@@ -0,0 +1,65 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class StatisticsTest(DatabaseTestCase):
+    async def test_statistics(self):
+        statistics = rocksdb.Statistics.CreateDBStatistics()
+        options = rocksdb.Options(create_if_missing=True)
+        options.statistics = statistics
+
+        async with self.open(options=options) as db:
+            for i in range(10):
+                await db.put(rocksdb.WriteOptions(), f"key-{i}", "value")
+
+            self.assertEqual(statistics.GetTickerCount("rocksdb.number.keys.written"), 10)
+            self.assertIsNone(statistics.GetTickerCount("missing"))
+
+            result = statistics.to_dict()
+            self.assertEqual(result["tickers"]["rocksdb.number.keys.written"], 10)
+            self.assertEqual(result["histograms"]["rocksdb.db.write.micros"]["count"], 10)
+
+    async def test_perf_context(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "value")
+
+            with db.perfContext() as perf:
+                await db.get(rocksdb.ReadOptions(), "key")
+                await db.get(rocksdb.ReadOptions(), "missing")
+
+            # Requests outside the block are not captured
+            await db.get(rocksdb.ReadOptions(), "key")
+
+            counters = perf.to_dict()
+            self.assertEqual(counters["requests"], 2)
+            self.assertEqual(counters["get_from_memtable_count"], 2)
+
+    async def test_nested_perf_contexts(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "value")
+
+            with db.perfContext() as outer:
+                await db.get(rocksdb.ReadOptions(), "key")
+                with db.perfContext(rocksdb.PerfLevel.enable_count) as inner:
+                    await db.get(rocksdb.ReadOptions(), "key")
+                await db.get(rocksdb.ReadOptions(), "key")
+
+            # The inner block doesn't reset what the outer one already captured
+            self.assertEqual(inner.to_dict()["requests"], 1)
+            self.assertEqual(inner.to_dict()["get_from_memtable_count"], 1)
+            self.assertEqual(outer.to_dict()["requests"], 3)
+            self.assertEqual(outer.to_dict()["get_from_memtable_count"], 3)
+
+    async def test_properties(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "key", "value")
+
+            properties = await db.getIntProperties(
+                ["rocksdb.num-entries-active-mem-table", "rocksdb.missing"]
+            )
+            self.assertEqual(properties, {"rocksdb.num-entries-active-mem-table": 1})
+
+            response = await db.getMapProperty("rocksdb.cfstats")
+            self.assertTrue(response.status.ok)
+            self.assertIsInstance(response.properties, dict)
@@ -0,0 +1,68 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class TableOptionsTest(DatabaseTestCase):
+    def test_round_trip(self):
+        options = rocksdb.Options(
+            table_options=rocksdb.BlockBasedTableOptions(
+                block_size=16384,
+                index_type=rocksdb.IndexType.two_level_index_search,
+                filter_policy=rocksdb.FilterPolicy.NewRibbonFilterPolicy(10),
+            )
+        )
+
+        table_options = options.table_options
+        self.assertEqual(table_options.block_size, 16384)
+        self.assertEqual(table_options.index_type, rocksdb.IndexType.two_level_index_search)
+        self.assertIn("Ribbon", table_options.filter_policy.name)
+
+    def test_modify_in_place(self):
+        options = rocksdb.Options()
+        options.table_options.block_size = 16384
+        options.table_options.filter_policy = rocksdb.FilterPolicy.NewBloomFilterPolicy(10)
+        self.assertEqual(options.table_options.block_size, 16384)
+        self.assertIn("Bloom", options.table_options.filter_policy.name)
+
+        # The table options outlive the expression that got them from `options`
+        table_options = rocksdb.Options().table_options
+        table_options.block_size = 8192
+        self.assertEqual(table_options.block_size, 8192)
+
+    async def test_modify_after_open(self):
+        options = rocksdb.Options(create_if_missing=True)
+        options.table_options.block_size = 8192
+
+        async with self.open(options=options) as db:
+            # The open database keeps its own table factory, later changes only apply to `options`
+            options.table_options.block_size = 32768
+            self.assertEqual(options.table_options.block_size, 32768)
+
+            response = await db.getOptions()
+            self.assertEqual(response.options.table_options.block_size, 8192)
+
+    def test_cache_capacity(self):
+        cache = rocksdb.Cache.NewLRUCache(1 << 20, num_shard_bits=2, strict_capacity_limit=True)
+        self.assertTrue(cache.strict_capacity_limit)
+        self.assertEqual(cache.capacity, 1 << 20)
+
+        cache.capacity = 2 << 20
+        self.assertEqual(cache.to_dict()["capacity"], 2 << 20)
+
+    async def test_shared_cache(self):
+        cache = rocksdb.Cache.NewLRUCache(8 << 20)
+        options = rocksdb.Options(
+            create_if_missing=True,
+            table_options=rocksdb.BlockBasedTableOptions(block_cache=cache),
+        )
+
+        # Both databases read their blocks through the same cache
+        async with self.open(self.path, options) as db, self.open(self.path + "-2", options) as other:
+            for database in (db, other):
+                await database.put(rocksdb.WriteOptions(), "key", "value")
+                await database.flush(rocksdb.FlushOptions())
+                response = await database.get(rocksdb.ReadOptions(), "key")
+                self.assertEqual(response.value, "value")
+
+            self.assertGreater(cache.usage, 0)
@@ -0,0 +1,120 @@
+from base import DatabaseTestCase
+
+import rocksdb, asyncio, threading
+
+
+class TransactionTest(DatabaseTestCase):
+    async def test_optimistic_conflict(self):
+        async with self.open(transaction_db=rocksdb.TransactionDBType.optimistic) as db:
+            async with db.transaction(rocksdb.WriteOptions()) as txn:
+                response = await txn.getForUpdate(rocksdb.ReadOptions(), "key")
+                self.assertTrue(response.status.is_not_found)
+
+                # Written by someone else after the transaction read it
+                await db.put(rocksdb.WriteOptions(), "key", "db")
+
+                await txn.put("key", "txn")
+                response = await txn.commit()
+                self.assertTrue(response.status.is_busy)
+
+            response = await db.get(rocksdb.ReadOptions(), "key")
+            self.assertEqual(response.value, "db")
+
+    async def test_pessimistic_lock_timeout(self):
+        async with self.open(transaction_db=rocksdb.TransactionDBType.pessimistic) as db:
+            async with db.transaction(rocksdb.WriteOptions()) as txn:
+                await txn.getForUpdate(rocksdb.ReadOptions(), "key")
+
+                other = db.transaction(
+                    rocksdb.WriteOptions(), rocksdb.TransactionOptions(lock_timeout=10)
+                )
+                async with other:
+                    response = await other.getForUpdate(rocksdb.ReadOptions(), "key")
+                    self.assertTrue(response.status.is_timed_out)
+
+                await txn.put("key", "txn")
+                response = await txn.commit()
+                self.assertTrue(response.status.ok)
+
+            response = await db.get(rocksdb.ReadOptions(), "key")
+            self.assertEqual(response.value, "txn")
+
+    async def test_save_points(self):
+        async with self.open(transaction_db=rocksdb.TransactionDBType.pessimistic) as db:
+            async with db.transaction(rocksdb.WriteOptions()) as txn:
+                await txn.put("a", "1")
+                await txn.setSavePoint()
+                await txn.put("b", "2")
+                self.assertEqual(await txn.getNumKeys(), 2)
+
+                response = await txn.rollbackToSavePoint()
+                self.assertTrue(response.status.ok)
+                response = await txn.get(rocksdb.ReadOptions(), "b")
+                self.assertTrue(response.status.is_not_found)
+
+                response = await txn.commit()
+                self.assertTrue(response.status.ok)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["a", "b"])
+            self.assertTrue(response.statuses[0].ok)
+            self.assertTrue(response.statuses[1].is_not_found)
+
+    async def test_lock_wait(self):
+        async with self.open(transaction_db=rocksdb.TransactionDBType.pessimistic) as db:
+            holder = db.transaction(rocksdb.WriteOptions())
+            await holder.put("key", "holder")
+
+            # The waiter blocks on the lock without blocking the holder's commit
+            waiter = db.transaction(rocksdb.WriteOptions(), rocksdb.TransactionOptions(lock_timeout=5000))
+            waiting = asyncio.ensure_future(waiter.getForUpdate(rocksdb.ReadOptions(), "key"))
+            await asyncio.sleep(0.05)
+
+            response = await holder.commit()
+            self.assertTrue(response.status.ok)
+
+            response = await waiting
+            self.assertEqual(response.value, "holder")
+
+            await holder.close()
+            await waiter.close()
+
+    async def test_concurrent_requests(self):
+        async with self.open(workers=4, transaction_db=rocksdb.TransactionDBType.optimistic) as db:
+            async with db.transaction(rocksdb.WriteOptions()) as txn:
+                # Requests of one transaction never run on two workers at once
+                responses = await asyncio.gather(
+                    *(txn.put(f"key-{i:03d}", str(i)) for i in range(200))
+                )
+                self.assertTrue(all(response.status.ok for response in responses))
+                self.assertEqual(await txn.getNumKeys(), 200)
+
+                gets = [txn.get(rocksdb.ReadOptions(), f"key-{i:03d}") for i in range(100)]
+                results = await asyncio.gather(*gets, txn.close(), return_exceptions=True)
+
+                # Close waits for the request in flight, the ones queued behind it fail cleanly
+                for result in results[:-1]:
+                    if not isinstance(result, Exception):
+                        self.assertTrue(result.status.ok)
+                self.assertIsNone(results[-1])
+
+    async def test_bounded_transaction_workers(self):
+        async with self.open(
+            transaction_db=rocksdb.TransactionDBType.pessimistic, transaction_workers=2
+        ) as db:
+
+            async def write(i: int) -> rocksdb.Response:
+                async with db.transaction(rocksdb.WriteOptions()) as txn:
+                    await txn.getForUpdate(rocksdb.ReadOptions(), f"key-{i}")
+                    await txn.put(f"key-{i}", "value")
+                    return await txn.commit()
+
+            # More transactions than workers share the pool instead of starting a thread each
+            responses = await asyncio.gather(*(write(i) for i in range(20)))
+            self.assertTrue(all(response.status.ok for response in responses))
+
+            threads = [
+                thread
+                for thread in threading.enumerate()
+                if thread.name.startswith("rocksdb-transaction")
+            ]
+            self.assertLessEqual(len(threads), 2)
@@ -0,0 +1,40 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class WideColumnsTest(DatabaseTestCase):
+    async def test_entity(self):
+        async with self.open() as db:
+            response = await db.putEntity(
+                rocksdb.WriteOptions(), "user", {"": "summary", "name": "aymen", "city": "tunis"}
+            )
+            if response.status.is_not_supported:
+                self.skipTest("wide columns need RocksDB 8.0")
+            self.assertTrue(response.status.ok)
+
+            response = await db.getEntity(rocksdb.ReadOptions(), "user")
+            self.assertEqual(
+                response.columns, {b"": b"summary", b"name": b"aymen", b"city": b"tunis"}
+            )
+
+            response = await db.getEntity(rocksdb.ReadOptions(), "user", names=["name"])
+            self.assertEqual(response.columns, {b"name": b"aymen"})
+
+            # The default column is the plain value of the key
+            response = await db.get(rocksdb.ReadOptions(), "user")
+            self.assertEqual(response.value, "summary")
+
+    async def test_blob_files(self):
+        options = rocksdb.Options(create_if_missing=True, enable_blob_files=True, min_blob_size=64)
+
+        async with self.open(options=options) as db:
+            await db.put(rocksdb.WriteOptions(), "small", "value")
+            await db.put(rocksdb.WriteOptions(), "large", "value" * 100)
+            await db.flush(rocksdb.FlushOptions())
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["small", "large"])
+            self.assertEqual(response.values, ["value", "value" * 100])
+
+            properties = await db.getIntProperties(["rocksdb.num-blob-files"])
+            self.assertEqual(properties["rocksdb.num-blob-files"], 1)
@@ -0,0 +1,40 @@
+from base import DatabaseTestCase
+
+import rocksdb
+
+
+class WriteBatchTest(DatabaseTestCase):
+    async def test_write(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "stale", "1")
+
+            batch = rocksdb.WriteBatch()
+            batch.Put("a", "1")
+            batch.PutMany([("b", "2"), ("c", "3")])
+            batch.Delete("stale")
+            self.assertEqual(len(batch), 4)
+
+            response = await db.write(rocksdb.WriteOptions(), batch)
+            self.assertTrue(response.status.ok)
+
+            response = await db.multiGet(rocksdb.ReadOptions(), ["a", "b", "c", "stale"])
+            self.assertEqual(response.values[:3], ["1", "2", "3"])
+            self.assertTrue(response.statuses[3].is_not_found)
+
+    async def test_get_from_batch_and_db(self):
+        async with self.open() as db:
+            await db.put(rocksdb.WriteOptions(), "a", "db")
+            await db.put(rocksdb.WriteOptions(), "b", "db")
+
+            batch = rocksdb.WriteBatchWithIndex(overwrite_key=True)
+            batch.Put("a", "batch")
+            batch.Delete("b")
+
+            response = await db.getFromBatchAndDB(rocksdb.ReadOptions(), batch, "a")
+            self.assertEqual(response.value, "batch")
+            response = await db.getFromBatchAndDB(rocksdb.ReadOptions(), batch, "b")
+            self.assertTrue(response.status.is_not_found)
+
+            # Nothing is written until the batch is
+            response = await db.get(rocksdb.ReadOptions(), "a")
+            self.assertEqual(response.value, "db")